@@ -0,0 +1,120 @@
+#include "gantt_lod.h"
+
+#include <algorithm>
+
+#include "parallel.h"
+
+namespace
+{
+    // Bloque en construccion
+    struct PendingBucket
+    {
+        int bucket;
+        LodSummary summary;
+    };
+
+    LodBucket Finish(const PendingBucket &p)
+    {
+        return {p.bucket, static_cast<int>(p.summary.busy), p.summary.process,
+                static_cast<int>(p.summary.processBusy)};
+    }
+
+    // Agrega un aporte al ultimo bloque si es el mismo; si no, abre uno nuevo
+    void Accumulate(std::vector<PendingBucket> &pending, std::vector<LodBucket> &out,
+                    int bucket, size_t proc, int cycles, int processCycles)
+    {
+        if (pending.empty() || pending.back().bucket != bucket)
+        {
+            if (!pending.empty())
+                out.push_back(Finish(pending.back()));
+            pending.assign(1, PendingBucket{bucket, LodSummary()});
+        }
+        pending.back().summary.Add(proc, cycles, processCycles);
+    }
+
+    // Niveles de un carril: el 0 sale de los segmentos, cada uno de los
+    // siguientes del anterior. Se detiene cuando queda un solo bloque.
+    std::vector<std::vector<LodBucket>> BuildLane(const GanttSegment *seg, const GanttSegment *fin)
+    {
+        std::vector<std::vector<LodBucket>> levels(1);
+        std::vector<PendingBucket> pending;
+
+        const int shift = GanttLodIndex::kBaseShift;
+        for (; seg != fin; ++seg)
+        {
+            if (seg->length <= 0)
+                continue;
+            long long inicio = seg->start;
+            long long fin = inicio + seg->length;
+            for (long long b = inicio >> shift; b <= (fin - 1) >> shift; ++b)
+            {
+                long long desde = std::max(inicio, b << shift);
+                long long hasta = std::min(fin, (b + 1) << shift);
+                int ciclos = static_cast<int>(hasta - desde);
+                Accumulate(pending, levels[0], static_cast<int>(b), seg->process, ciclos, ciclos);
+            }
+        }
+        if (!pending.empty())
+            levels[0].push_back(Finish(pending.back()));
+
+        while (levels.back().size() > 1 && GanttLodIndex::Shift(levels.size()) < 31)
+        {
+            const std::vector<LodBucket> &previo = levels.back();
+            std::vector<LodBucket> nivel;
+            pending.clear();
+            for (const LodBucket &b : previo)
+                Accumulate(pending, nivel, b.bucket >> GanttLodIndex::kLevelShift,
+                           b.process, b.busy, b.processBusy);
+            if (!pending.empty())
+                nivel.push_back(Finish(pending.back()));
+            levels.push_back(std::move(nivel));
+        }
+        return levels;
+    }
+}
+
+void GanttLodIndex::Build(const std::vector<GanttSegment> &segments,
+                          const std::vector<std::pair<size_t, size_t>> &lanes, unsigned threads)
+{
+    m_levels.clear();
+
+    // 1. Cada carril es independiente
+    std::vector<std::vector<std::vector<LodBucket>>> porCarril(lanes.size());
+    ParallelFor(lanes.size(), [&](size_t i)
+                {
+        const GanttSegment *inicio = segments.data() + lanes[i].first;
+        porCarril[i] = BuildLane(inicio, inicio + lanes[i].second); },
+                threads);
+
+    // 2. Unir por nivel en CSR; un carril sin niveles tan gruesos no aporta bloques
+    size_t niveles = 0;
+    for (const auto &carril : porCarril)
+        niveles = std::max(niveles, carril.size());
+    m_levels.resize(niveles);
+    for (size_t k = 0; k < niveles; ++k)
+    {
+        Level &nivel = m_levels[k];
+        nivel.offset.assign(1, 0);
+        for (const auto &carril : porCarril)
+        {
+            if (k < carril.size())
+                nivel.buckets.insert(nivel.buckets.end(), carril[k].begin(), carril[k].end());
+            else if (!carril.empty() && !carril.back().empty())
+            {
+                // Un solo bloque ya cubre el carril: se reagrupa al nivel k
+                LodBucket b = carril.back().front();
+                b.bucket >>= (k - (carril.size() - 1)) * kLevelShift;
+                nivel.buckets.push_back(b);
+            }
+            nivel.offset.push_back(nivel.buckets.size());
+        }
+    }
+}
+
+int GanttLodIndex::LevelFor(double cycles) const
+{
+    int nivel = -1;
+    for (size_t k = 0; k < m_levels.size() && (1LL << Shift(k)) <= cycles; ++k)
+        nivel = static_cast<int>(k);
+    return nivel;
+}
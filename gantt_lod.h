@@ -0,0 +1,105 @@
+#ifndef GANTT_LOD_H
+#define GANTT_LOD_H
+
+// Indice de varias resoluciones para dibujar el Gantt alejado. Cada nivel
+// divide el tiempo en bloques de 4, 16, 64... ciclos y guarda, por carril,
+// solo los bloques con algun ciclo ocupado: cuantos ciclos estan ocupados y
+// que proceso domina. Asi una columna de pixeles que cubre miles de ciclos
+// se resume con unos pocos bloques en lugar de recorrer todos sus segmentos.
+// No depende de wxWidgets.
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+// Segmento de un carril del Gantt; 'process' es el indice del proceso (color y PID)
+struct GanttSegment
+{
+    int start;
+    int length;
+    size_t process;
+};
+
+// Resumen de los ciclos que caen en un intervalo (un bloque del indice o una
+// columna de pixeles). El proceso dominante es el de la racha consecutiva mas
+// larga, que coincide con el de mas ciclos cuando cada proceso ocupa un solo
+// tramo del intervalo (lo habitual); si no, es una aproximacion.
+struct LodSummary
+{
+    double busy = 0;        // ciclos ocupados
+    size_t process = 0;     // proceso dominante
+    double processBusy = 0; // ciclos de su racha
+    size_t runProcess = 0;  // racha en curso
+    double runBusy = 0;
+
+    // Agrega 'cycles' ciclos ocupados, de los cuales 'processCycles' son de
+    // 'proc' (un segmento aporta ambos iguales; un bloque, su dominante)
+    void Add(size_t proc, double cycles, double processCycles)
+    {
+        busy += cycles;
+        if (runBusy > 0 && runProcess == proc)
+            runBusy += processCycles;
+        else
+        {
+            runProcess = proc;
+            runBusy = processCycles;
+        }
+        if (runBusy > processBusy)
+        {
+            process = runProcess;
+            processBusy = runBusy;
+        }
+    }
+};
+
+// Bloque de un nivel: ciclos [bucket << shift, (bucket + 1) << shift)
+struct LodBucket
+{
+    int bucket;
+    int busy;
+    size_t process;
+    int processBusy;
+};
+
+class GanttLodIndex
+{
+public:
+    static const int kBaseShift = 2;  // nivel 0: bloques de 4 ciclos
+    static const int kLevelShift = 2; // cada nivel agrupa 4 bloques del anterior
+
+    void Clear() { m_levels.clear(); }
+
+    // 'lanes' son los rangos [first, first + count) de 'segments' de cada
+    // carril, ordenados por inicio y sin solaparse. Los carriles se procesan
+    // con 'threads' hilos (0 = todos los nucleos).
+    void Build(const std::vector<GanttSegment> &segments,
+               const std::vector<std::pair<size_t, size_t>> &lanes, unsigned threads = 0);
+
+    size_t Levels() const { return m_levels.size(); }
+    static int Shift(size_t level) { return kBaseShift + static_cast<int>(level) * kLevelShift; }
+
+    // Nivel mas grueso cuyos bloques no superan 'cycles' ciclos; -1 si ni
+    // los del nivel 0 caben
+    int LevelFor(double cycles) const;
+
+    // Bloques del carril en el nivel, ordenados por 'bucket'
+    const LodBucket *Begin(size_t level, size_t lane) const
+    {
+        return m_levels[level].buckets.data() + m_levels[level].offset[lane];
+    }
+    const LodBucket *End(size_t level, size_t lane) const
+    {
+        return m_levels[level].buckets.data() + m_levels[level].offset[lane + 1];
+    }
+
+private:
+    // Un nivel en formato CSR: los bloques del carril i son [offset[i], offset[i + 1])
+    struct Level
+    {
+        std::vector<size_t> offset;
+        std::vector<LodBucket> buckets;
+    };
+    std::vector<Level> m_levels;
+};
+
+#endif // GANTT_LOD_H
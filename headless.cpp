@@ -0,0 +1,427 @@
+#include "headless.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "scheduler.h"
+#include "workload.h"
+#include "workload_binary.h"
+
+namespace
+{
+    void PrintUsage(const char *prog)
+    {
+        std::printf(
+            "Uso: %s --headless <procesos.txt> [opciones]\n"
+            "\n"
+            "Opciones:\n"
+            "  -a, --algorithms LISTA  Algoritmos separados por coma\n"
+            "                          (fifo,sjf,srt,rr,priority,mlfq,cfs,priorityp,edf,rm)\n"
+            "                          o \"all\" (por defecto)\n"
+            "  -q, --quantum N         Quantum para Round Robin (por defecto 3)\n"
+            "  -l, --mlfq-levels N     Niveles de MLFQ (por defecto 3, maximo %d)\n"
+            "  -m, --mlfq-quanta LISTA Quantum de cada nivel de MLFQ separados por coma\n"
+            "                          (por defecto 2,4,8; los niveles sin valor duplican\n"
+            "                          el anterior)\n"
+            "  -B, --mlfq-boost N      Ciclos entre subidas de todos los procesos al\n"
+            "                          nivel 0 de MLFQ (por defecto 50; 0 = nunca)\n"
+            "  -L, --cfs-latency N     Latencia objetivo de CFS en ciclos (por defecto 24)\n"
+            "  -G, --cfs-granularity N Granularidad minima de CFS en ciclos (por defecto 3)\n"
+            "  -A, --aging-interval N  Ciclos de espera por nivel ganado en PriorityP\n"
+            "                          (por defecto 5; 0 = sin envejecimiento)\n"
+            "  -C, --aging-cap N       Mejor prioridad alcanzable envejeciendo (por defecto 0)\n"
+            "  -H, --horizon N         Ciclo hasta el que EDF y RM liberan trabajos periodicos\n"
+            "                          (por defecto 0 = ultima llegada + hiperperiodo)\n"
+            "  -c, --cpus N            Simular N CPUs (variantes SMP; 1 a %d, por defecto 1)\n"
+            "  -b, --balance MODO      Balanceo entre CPUs: global, push o steal\n"
+            "                          (por defecto steal)\n"
+            "  -j, --threads N         Hilos para cargar el archivo y ejecutar los\n"
+            "                          algoritmos en paralelo\n"
+            "                          (por defecto todos los nucleos)\n"
+            "  -s, --sweep-quantum MIN:MAX[:PASO]\n"
+            "                          Barrido de Round Robin sobre un rango de quantum\n"
+            "                          (en paralelo); imprime una fila por quantum\n"
+            "  -x, --export SALIDA     Convertir el archivo de entrada al formato binario\n"
+            "                          y terminar\n"
+            "  -k, --kind TIPO         Tipo del archivo a convertir: procesos (por defecto),\n"
+            "                          recursos o acciones\n"
+            "  -d, --detail            Imprimir tabla por proceso\n"
+            "  -g, --gantt             Imprimir los segmentos de ejecucion por proceso\n"
+            "  -h, --help              Mostrar esta ayuda\n",
+            prog, kMaxMlfqLevels, kMaxCpus);
+    }
+
+    bool ParseAlgorithmList(const std::string &list, std::vector<Algorithm> &algs)
+    {
+        algs.clear();
+        if (list == "all")
+        {
+            algs = {Algorithm::FIFO, Algorithm::SJF, Algorithm::SRT, Algorithm::RR, Algorithm::Priority,
+                    Algorithm::MLFQ, Algorithm::CFS, Algorithm::PriorityP, Algorithm::EDF, Algorithm::RM};
+            return true;
+        }
+
+        size_t inicio = 0;
+        while (inicio <= list.size())
+        {
+            size_t fin = list.find(',', inicio);
+            if (fin == std::string::npos)
+                fin = list.size();
+            Algorithm alg;
+            if (!ParseAlgorithm(list.substr(inicio, fin - inicio), alg))
+            {
+                std::fprintf(stderr, "Algoritmo desconocido: \"%s\"\n",
+                             list.substr(inicio, fin - inicio).c_str());
+                return false;
+            }
+            algs.push_back(alg);
+            inicio = fin + 1;
+        }
+        return !algs.empty();
+    }
+
+    void PrintWarnings(const std::vector<std::string> &warnings)
+    {
+        for (const auto &w : warnings)
+            std::fprintf(stderr, "Advertencia: %s\n", w.c_str());
+    }
+
+    size_t RowCount(const Workload &rows) { return rows.Size(); }
+    template <typename T>
+    size_t RowCount(const std::vector<T> &rows) { return rows.size(); }
+
+    // Carga 'input' (CSV o binario) y lo guarda en formato binario en 'output'
+    template <typename Rows, typename Load, typename Save>
+    int Export(const std::string &input, const std::string &output, unsigned threads,
+               Load load, Save save)
+    {
+        SymbolTable symbols;
+        Rows rows;
+        std::vector<std::string> warnings;
+        if (!load(input, symbols, rows, warnings, threads))
+        {
+            std::fprintf(stderr, "No se pudo abrir el archivo: %s\n", input.c_str());
+            return EXIT_FAILURE;
+        }
+        PrintWarnings(warnings);
+
+        if (!save(output, symbols, rows))
+        {
+            std::fprintf(stderr, "No se pudo escribir el archivo: %s\n", output.c_str());
+            return EXIT_FAILURE;
+        }
+        std::printf("%zu filas exportadas a %s\n", RowCount(rows), output.c_str());
+        return EXIT_SUCCESS;
+    }
+
+    int ExportBinary(const std::string &kind, const std::string &input, const std::string &output,
+                     unsigned threads)
+    {
+        if (kind == "procesos")
+            return Export<Workload>(input, output, threads, LoadProcessFile, SaveProcessFileBinary);
+        if (kind == "recursos")
+            return Export<std::vector<SyncResource>>(input, output, threads, LoadResourceFile, SaveResourceFileBinary);
+        if (kind == "acciones")
+            return Export<std::vector<SyncAction>>(input, output, threads, LoadActionFile, SaveActionFileBinary);
+
+        std::fprintf(stderr, "Tipo de archivo desconocido: \"%s\" (use procesos, recursos o acciones)\n",
+                     kind.c_str());
+        return EXIT_FAILURE;
+    }
+
+    void PrintResult(Algorithm alg, const SymbolTable &symbols, const Workload &procs,
+                     const ScheduleResult &result, bool detail, bool gantt)
+    {
+        std::printf("== %s ==\n", AlgorithmName(alg));
+        std::printf("Avg Waiting Time:    %.2f\n", result.metrics.avgWaitingTime);
+        std::printf("Avg Turnaround Time: %.2f\n", result.metrics.avgTurnaroundTime);
+        std::printf("Throughput:          %.4f\n", result.metrics.throughput);
+        std::printf("Makespan:            %d\n", result.metrics.makespan);
+        std::printf("Max Waiting Time:    %d\n", result.metrics.maxWaitTime);
+        std::printf("Context Switches:    %d\n", result.metrics.contextSwitches);
+        if (result.cpus > 1)
+            std::printf("Migrations:          %d\n", result.metrics.migrations);
+
+        const RealTimeStats &rt = result.realtime;
+        if (!rt.Empty())
+        {
+            static const char *veredicto[] = {"guaranteed", "inconclusive", "overloaded"};
+            std::printf("Jobs:                %d", rt.totalJobs);
+            if (rt.horizon > 0)
+                std::printf(" (horizon %d)", rt.horizon);
+            std::printf("\n");
+            std::printf("Deadline Misses:     %d\n", rt.totalMisses);
+            std::printf("Worst Lateness:      %d\n", rt.worstLateness);
+            std::printf("Utilization:         %.4f (bound %.4f, %s)\n", rt.utilization,
+                        rt.utilizationBound, veredicto[static_cast<int>(rt.Verdict())]);
+        }
+
+        if (detail)
+        {
+            std::printf("%-10s %8s %8s %8s %8s %8s %8s %8s %8s\n",
+                        "PID", "BT", "AT", "Prio", "Start", "Finish", "Wait", "MaxWait", "TAT");
+            for (size_t i = 0; i < procs.Size(); ++i)
+            {
+                std::printf("%-10s %8d %8d %8d %8d %8d %8d %8d %8d\n",
+                            symbols.Name(procs.pid[i]).c_str(), procs.burstTime[i],
+                            procs.arrivalTime[i], procs.priority[i],
+                            result.startTime[i], result.finishTime[i], result.waitingTime[i],
+                            result.maxWaitTime[i], result.finishTime[i] - procs.arrivalTime[i]);
+            }
+
+            if (!rt.Empty())
+            {
+                std::printf("\n%-10s %8s %8s %8s %8s\n", "PID", "Period", "Jobs", "Misses", "MaxLate");
+                for (size_t i = 0; i < procs.Size(); ++i)
+                {
+                    std::string maxLate = procs.period[i] > 0 ? std::to_string(rt.maxLateness[i]) : "-";
+                    std::printf("%-10s %8d %8d %8d %8s\n", symbols.Name(procs.pid[i]).c_str(),
+                                procs.period[i], rt.jobs[i], rt.misses[i], maxLate.c_str());
+                }
+            }
+        }
+
+        if (gantt)
+        {
+            for (size_t i = 0; i < procs.Size(); ++i)
+            {
+                std::printf("%s:", symbols.Name(procs.pid[i]).c_str());
+                for (size_t k = result.segmentOffset[i]; k < result.segmentOffset[i + 1]; ++k)
+                {
+                    const ExecSegment &seg = result.segments[k];
+                    std::printf(" [%d,%d)", seg.start, seg.start + seg.length);
+                    if (!result.segmentCpu.empty())
+                        std::printf("@%d", result.segmentCpu[k]);
+                }
+                std::printf("\n");
+            }
+        }
+        std::printf("\n");
+    }
+
+    // "MIN:MAX" o "MIN:MAX:PASO"
+    bool ParseSweepRange(const std::string &text, int &minQ, int &maxQ, int &step)
+    {
+        step = 1;
+        int campos = std::sscanf(text.c_str(), "%d:%d:%d", &minQ, &maxQ, &step);
+        if (campos < 2 || minQ < 1 || maxQ < minQ || step < 1)
+        {
+            std::fprintf(stderr, "Rango de quantum invalido: \"%s\" (use MIN:MAX[:PASO])\n", text.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    void PrintSweep(const std::vector<QuantumSweepPoint> &points)
+    {
+        std::printf("== Barrido de quantum (RR) ==\n");
+        std::printf("%8s %12s %12s %12s %10s %10s\n",
+                    "Quantum", "AvgWait", "AvgTAT", "Throughput", "Makespan", "CtxSwitch");
+        for (const auto &pt : points)
+        {
+            std::printf("%8d %12.2f %12.2f %12.4f %10d %10d\n",
+                        pt.quantum, pt.metrics.avgWaitingTime, pt.metrics.avgTurnaroundTime,
+                        pt.metrics.throughput, pt.metrics.makespan, pt.metrics.contextSwitches);
+        }
+        std::printf("\n");
+    }
+}
+
+int RunHeadless(int argc, char **argv)
+{
+    std::string workloadFile;
+    std::vector<Algorithm> algs;
+    ParseAlgorithmList("all", algs);
+    SchedulerOptions options;
+    bool detail = false;
+    bool gantt = false;
+    bool sweep = false;
+    int sweepMin = 1, sweepMax = 1, sweepStep = 1;
+    std::string exportFile;
+    std::string exportKind = "procesos";
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (arg == "--headless")
+            continue;
+
+        if (arg == "-h" || arg == "--help")
+        {
+            PrintUsage(argv[0]);
+            return EXIT_SUCCESS;
+        }
+        else if ((arg == "-a" || arg == "--algorithms") && i + 1 < argc)
+        {
+            if (!ParseAlgorithmList(argv[++i], algs))
+                return EXIT_FAILURE;
+        }
+        else if ((arg == "-q" || arg == "--quantum") && i + 1 < argc)
+        {
+            options.quantum = std::atoi(argv[++i]);
+            if (options.quantum < 1)
+            {
+                std::fprintf(stderr, "El quantum debe ser mayor que 0\n");
+                return EXIT_FAILURE;
+            }
+        }
+        else if ((arg == "-l" || arg == "--mlfq-levels") && i + 1 < argc)
+        {
+            options.mlfqLevels = std::atoi(argv[++i]);
+            if (options.mlfqLevels < 1 || options.mlfqLevels > kMaxMlfqLevels)
+            {
+                std::fprintf(stderr, "El numero de niveles de MLFQ debe estar entre 1 y %d\n", kMaxMlfqLevels);
+                return EXIT_FAILURE;
+            }
+        }
+        else if ((arg == "-m" || arg == "--mlfq-quanta") && i + 1 < argc)
+        {
+            if (!ParseQuantumList(argv[++i], options.mlfqQuanta))
+            {
+                std::fprintf(stderr, "Lista de quantum invalida: \"%s\" (use N,N,...)\n", argv[i]);
+                return EXIT_FAILURE;
+            }
+        }
+        else if ((arg == "-B" || arg == "--mlfq-boost") && i + 1 < argc)
+        {
+            options.mlfqBoost = std::max(0, std::atoi(argv[++i]));
+        }
+        else if ((arg == "-L" || arg == "--cfs-latency") && i + 1 < argc)
+        {
+            options.cfsTargetLatency = std::atoi(argv[++i]);
+            if (options.cfsTargetLatency < 1)
+            {
+                std::fprintf(stderr, "La latencia objetivo de CFS debe ser mayor que 0\n");
+                return EXIT_FAILURE;
+            }
+        }
+        else if ((arg == "-G" || arg == "--cfs-granularity") && i + 1 < argc)
+        {
+            options.cfsMinGranularity = std::atoi(argv[++i]);
+            if (options.cfsMinGranularity < 1)
+            {
+                std::fprintf(stderr, "La granularidad minima de CFS debe ser mayor que 0\n");
+                return EXIT_FAILURE;
+            }
+        }
+        else if ((arg == "-A" || arg == "--aging-interval") && i + 1 < argc)
+        {
+            options.agingInterval = std::max(0, std::atoi(argv[++i]));
+        }
+        else if ((arg == "-C" || arg == "--aging-cap") && i + 1 < argc)
+        {
+            options.agingCap = std::atoi(argv[++i]);
+        }
+        else if ((arg == "-H" || arg == "--horizon") && i + 1 < argc)
+        {
+            options.realtimeHorizon = std::max(0, std::atoi(argv[++i]));
+        }
+        else if ((arg == "-c" || arg == "--cpus") && i + 1 < argc)
+        {
+            options.cpus = std::atoi(argv[++i]);
+            if (options.cpus < 1 || options.cpus > kMaxCpus)
+            {
+                std::fprintf(stderr, "El numero de CPUs debe estar entre 1 y %d\n", kMaxCpus);
+                return EXIT_FAILURE;
+            }
+        }
+        else if ((arg == "-b" || arg == "--balance") && i + 1 < argc)
+        {
+            std::string modo = argv[++i];
+            if (modo == "global")
+                options.balance = LoadBalance::Global;
+            else if (modo == "push")
+                options.balance = LoadBalance::Push;
+            else if (modo == "steal")
+                options.balance = LoadBalance::WorkStealing;
+            else
+            {
+                std::fprintf(stderr, "Balanceo desconocido: \"%s\" (use global, push o steal)\n", modo.c_str());
+                return EXIT_FAILURE;
+            }
+        }
+        else if ((arg == "-j" || arg == "--threads") && i + 1 < argc)
+        {
+            int hilos = std::atoi(argv[++i]);
+            options.threads = hilos > 0 ? static_cast<unsigned>(hilos) : 0;
+        }
+        else if ((arg == "-s" || arg == "--sweep-quantum") && i + 1 < argc)
+        {
+            if (!ParseSweepRange(argv[++i], sweepMin, sweepMax, sweepStep))
+                return EXIT_FAILURE;
+            sweep = true;
+        }
+        else if ((arg == "-x" || arg == "--export") && i + 1 < argc)
+        {
+            exportFile = argv[++i];
+        }
+        else if ((arg == "-k" || arg == "--kind") && i + 1 < argc)
+        {
+            exportKind = argv[++i];
+        }
+        else if (arg == "-d" || arg == "--detail")
+        {
+            detail = true;
+        }
+        else if (arg == "-g" || arg == "--gantt")
+        {
+            gantt = true;
+        }
+        else if (!arg.empty() && arg[0] != '-' && workloadFile.empty())
+        {
+            workloadFile = arg;
+        }
+        else
+        {
+            std::fprintf(stderr, "Argumento no reconocido: %s\n", arg.c_str());
+            PrintUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (workloadFile.empty())
+    {
+        PrintUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    if (!exportFile.empty())
+        return ExportBinary(exportKind, workloadFile, exportFile, options.threads);
+
+    SymbolTable symbols;
+    Workload procs;
+    std::vector<std::string> warnings;
+    if (!LoadProcessFile(workloadFile, symbols, procs, warnings, options.threads))
+    {
+        std::fprintf(stderr, "No se pudo abrir el archivo de procesos: %s\n", workloadFile.c_str());
+        return EXIT_FAILURE;
+    }
+    PrintWarnings(warnings);
+
+    if (procs.Empty())
+    {
+        std::fprintf(stderr, "No hay procesos cargados.\n");
+        return EXIT_FAILURE;
+    }
+
+    std::printf("Procesos: %zu\n\n", procs.Size());
+
+    if (sweep)
+    {
+        PrintSweep(SweepRoundRobin(procs, sweepMin, sweepMax, sweepStep, options.threads));
+        return EXIT_SUCCESS;
+    }
+
+    // Todos los algoritmos corren en paralelo; se imprimen en el orden pedido
+    options.symbols = &symbols;
+    std::vector<ScheduleResult> results = RunSchedulers(algs, procs, options);
+    for (size_t k = 0; k < algs.size(); ++k)
+    {
+        PrintResult(algs[k], symbols, procs, results[k], detail, gantt);
+    }
+
+    return EXIT_SUCCESS;
+}
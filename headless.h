@@ -0,0 +1,9 @@
+#ifndef HEADLESS_H
+#define HEADLESS_H
+
+// Modo batch sin pantalla: "simulator --headless <archivo> [opciones]".
+// Carga la carga de trabajo, ejecuta los algoritmos pedidos y escribe los
+// resultados en la salida estandar. Devuelve el codigo de salida del proceso.
+int RunHeadless(int argc, char **argv);
+
+#endif // HEADLESS_H
@@ -0,0 +1,9 @@
+// Punto de entrada del simulador sin wxWidgets (objetivo "make headless").
+// Acepta los mismos argumentos que "simulator --headless".
+
+#include "headless.h"
+
+int main(int argc, char **argv)
+{
+    return RunHeadless(argc, argv);
+}
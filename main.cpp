@@ -8,48 +8,41 @@
 #include <wx/timer.h>
 #include <wx/statbox.h>
 #include <wx/checkbox.h>
+#include <wx/dialog.h>
 #include <vector>
 #include <string>
-#include <fstream>
-#include <sstream>
-#include <map>
 #include <algorithm>
-#include <queue>
-#include <tuple>
-#include <set>
+#include <climits>
+#include <functional>
+
+#include "scheduler.h"
+#include "workload.h"
+#include "headless.h"
+#include "gantt_lod.h"
+#include "sync.h"
 
 class MainFrame;
 class GanttChart;
 class TimelineChart;
 
-// Estructuras de datos
-struct Process
-{
-    wxString pid;
-    int burstTime;
-    int arrivalTime;
-    int priority;
-    wxColour color;
-
-    int startTime = 0;
-    int finishTime = 0;
-    int waitingTime = 0;
-
-    std::vector<std::pair<int, int>> segments;
-};
+// Estructuras de datos. Los nombres (PID, recurso, accion) son IDs de la
+// SymbolTable del panel; el texto solo se consulta para mostrarlo. Los
+// procesos se guardan en columnas (Workload) y su color sale de su indice.
 
-struct Resource
+// Carril del Gantt: una fila con titulo. Sus segmentos, en orden de tiempo,
+// son [first, first + count) del arreglo de segmentos compartido del grafico.
+struct GanttLane
 {
-    wxString name;
-    int counter;
+    wxString title;
+    size_t first;
+    size_t count;
 };
 
-struct Action
+// Resumen de cada columna de pixeles cuando el Gantt esta alejado
+enum class GanttSummary
 {
-    wxString pid;
-    wxString action;
-    wxString resource;
-    int cycle;
+    Dominant, // bloque completo del color del proceso dominante
+    Occupancy // altura proporcional a los ciclos ocupados
 };
 
 // Ventana principal
@@ -59,6 +52,26 @@ public:
     bool OnInit() override;
 };
 
+// Lista virtual (wxLC_VIRTUAL): no guarda filas; pide el texto de cada celda
+// visible a 'text' y, si se indica, su estilo a 'attr'. Con millones de filas
+// solo se formatean las que se muestran.
+class VirtualListCtrl : public wxListCtrl
+{
+public:
+    using TextFn = std::function<wxString(long item, long column)>;
+    using AttrFn = std::function<wxListItemAttr *(long item)>;
+
+    VirtualListCtrl(wxWindow *parent, const wxSize &size, TextFn text, AttrFn attr = AttrFn());
+    void SetRowCount(size_t rows);
+
+private:
+    wxString OnGetItemText(long item, long column) const override;
+    wxListItemAttr *OnGetItemAttr(long item) const override;
+
+    TextFn m_text;
+    AttrFn m_attr;
+};
+
 // Panel para visualizacion diagrama de Gantt
 class GanttChart : public wxScrolledWindow
 {
@@ -67,19 +80,65 @@ public:
     void StartSimulation();
     void StopSimulation();
     void ResetChart();
-    void SetProcesses(const std::vector<Process> &processes);
+    void SetProcesses(const Workload *workload, const SymbolTable *symbols);
+    void SetLanes(std::vector<GanttLane> lanes, std::vector<GanttSegment> segments);
+    void ZoomIn();
+    void ZoomOut();
+    void ZoomToFit();
+    void SetSummary(GanttSummary summary);
 
 private:
     void OnPaint(wxPaintEvent &event);
     void OnTimer(wxTimerEvent &event);
-    void DrawTimeAxis(wxPaintDC &dc);
-    void DrawProcessBlocks(wxPaintDC &dc);
+    void OnMouseWheel(wxMouseEvent &event);
+    void DrawChart(wxDC &dc, const wxRect &visible);
+    void DrawTimeAxis(wxDC &dc, const wxRect &visible);
+    void DrawProcessBlocks(wxDC &dc, const wxRect &visible);
+    void DrawLaneSegments(wxDC &dc, const GanttLane &lane, int y, double firstCycle, double lastCycle);
+    void DrawLaneSummary(wxDC &dc, size_t lane, int y, const wxRect &visible);
+    void RefreshLogicalRect(const wxRect &rect);
+    void InvalidateChart();
+    void ZoomBy(double factor, int clientX);
+    void UpdateVirtualSize();
+    int CycleX(double cycle) const;
+
+    // Geometria del diagrama (coordenadas logicas)
+    static const int kBaseY = 80;       // Y del primer carril
+    static const int kRowHeight = 30;   // Altura entre filas
+    static const int kBlockHeight = 25; // Alto del bloque de proceso
+    static const int kMarginX = 50;     // Margen izquierdo
+    static const int kLabelSlack = 80;  // Ancho que puede sobresalir una etiqueta
+    static const int kMinLabelWidth = 20; // Bloques mas angostos no llevan PID
+    static const int kScrollUnit = 20;  // Pixeles por unidad de scroll
+    static constexpr double kDefaultPxPerCycle = 30; // Escala horizontal inicial
+    static constexpr double kMaxPxPerCycle = 120;
+    static constexpr double kSummaryPxPerCycle = 1; // por debajo se resume por columna
 
     wxTimer *m_timer;
-    std::vector<Process> m_processes;
+    const Workload *m_workload;   // procesos del panel (sin copiar)
+    const SymbolTable *m_symbols; // nombres de los PID (del panel)
+    std::vector<GanttLane> m_lanes;
+    std::vector<GanttSegment> m_segments; // segmentos de todos los carriles
     int m_currentCycle;
+    int m_lastCycle; // fin del ultimo segmento de todos los carriles
     bool m_isRunning;
 
+    // Zoom: pixeles por ciclo (menor que 1 = varios ciclos por columna)
+    double m_scale;
+    GanttSummary m_summary;
+    GanttLodIndex m_lodIndex; // resumen de los carriles por bloques de ciclos
+
+    // Doble buffer: la vista ya dibujada y el origen logico al que corresponde
+    wxBitmap m_backBuffer;
+    wxPoint m_bufferOrigin;
+    bool m_bufferValid;
+
+    // Plumas y brochas reutilizadas entre bloques (una por color de la paleta)
+    std::vector<wxBrush> m_processBrushes;
+    std::vector<wxPen> m_processPens;
+    wxBrush m_pendingBrush;
+    wxPen m_pendingPen;
+
     wxDECLARE_EVENT_TABLE();
 };
 
@@ -91,35 +150,80 @@ public:
     void StartSimulation();
     void StopSimulation();
     void ResetChart();
-    void SetData(const std::vector<Process> &processes,
-                 const std::vector<Resource> &resources,
-                 const std::vector<Action> &actions);
 
-    // Setter para el modo de sincronización (Mutex Locks o Semaforos)
-    void SetSyncMode(const wxString &mode) { m_syncMode = mode; }
+    // Los datos son del panel (sin copiar); la linea de tiempo se simula
+    // completa al recibirlos. ClearData se llama antes de que el panel los
+    // modifique.
+    void SetData(const Workload *processes,
+                 const std::vector<SyncResource> *resources,
+                 const std::vector<SyncAction> *actions,
+                 const SyncActionIndex *actionIndex,
+                 const SymbolTable *symbols);
+    void ClearData();
+
+    // Mecanismo, orden de las colas de espera y retencion; vuelve a simular
+    void SetSyncOptions(const SyncOptions &options);
+    const SyncOptions &GetSyncOptions() const { return m_syncOptions; }
+    const SyncTimeline &GetTimeline() const { return m_timeline; }
+
+    // Se llama cada vez que la linea de tiempo se vuelve a simular
+    void SetSimulatedHandler(std::function<void()> handler) { m_onSimulated = std::move(handler); }
 
 private:
     void OnPaint(wxPaintEvent &event);
     void OnTimer(wxTimerEvent &event);
     void DrawTimeline(wxPaintDC &dc);
+    bool HasData() const;
+    void Simulate();
 
     wxTimer *m_timer;
-    std::vector<Process> m_processes;
-    std::vector<Resource> m_resources;
-    std::vector<Action> m_actions;
+    const Workload *m_processes;
+    const std::vector<SyncResource> *m_resources;
+    const std::vector<SyncAction> *m_actions;
+    const SyncActionIndex *m_actionIndex; // acciones por ciclo (del panel)
+    const SymbolTable *m_symbols;         // nombres de PID, recursos y acciones (del panel)
     int m_currentCycle;
     bool m_isRunning;
+    int m_readId; // ID de "READ" o -1
+
+    SyncOptions m_syncOptions;
+    SyncTimeline m_timeline; // resultado de SimulateSync; la vista solo lo consulta
+    std::function<void()> m_onSimulated;
+
+    wxDECLARE_EVENT_TABLE();
+};
+
+// Grafica de un barrido de quantum: una curva por metrica, normalizada a su maximo
+class SweepPlot : public wxPanel
+{
+public:
+    SweepPlot(wxWindow *parent, const std::vector<QuantumSweepPoint> &points);
 
-    std::map<wxString, int> m_resourceStates;
-    std::set<std::tuple<wxString, wxString, int>> m_actionsDone;
-    std::map<std::tuple<wxString, wxString, int>, int> m_actionStartCycle;
+private:
+    void OnPaint(wxPaintEvent &event);
 
-    wxString m_syncMode; // "Mutex Locks" o "Semaforos"
-    std::map<wxString, std::queue<int>> m_pendingReleases;
+    std::vector<QuantumSweepPoint> m_points;
 
     wxDECLARE_EVENT_TABLE();
 };
 
+// Ventana con la tabla y la grafica de un barrido de quantum de Round Robin
+class QuantumSweepDialog : public wxDialog
+{
+public:
+    QuantumSweepDialog(wxWindow *parent, const std::vector<QuantumSweepPoint> &points);
+};
+
+// Ventana con el paralelismo de cada recurso en la ultima simulacion,
+// comparado con la misma carga bajo un mutex
+class ParallelismDialog : public wxDialog
+{
+public:
+    ParallelismDialog(wxWindow *parent, const wxString &mode, const SymbolTable &symbols,
+                      const std::vector<SyncResource> &resources,
+                      const SyncTimeline &timeline, const SyncTimeline &mutex);
+};
+
 // Panel de calendarizacion
 class SchedulingPanel : public wxPanel
 {
@@ -133,29 +237,56 @@ private:
     void OnResetSimulation(wxCommandEvent &event);
     void OnAlgorithmCheck(wxCommandEvent &event);
     void OnQuantumChange(wxSpinEvent &event);
+    void OnQuantumSweep(wxCommandEvent &event);
+    void OnZoomIn(wxCommandEvent &event);
+    void OnZoomOut(wxCommandEvent &event);
+    void OnZoomFit(wxCommandEvent &event);
+    void OnSummaryChange(wxCommandEvent &event);
     void LoadProcessesFromFile(const wxString &filename);
     void UpdateMetrics();
-    void ScheduleFIFO();
-    void ScheduleSJF();
-    void ScheduleSRT();
-    void ScheduleRR();
-    void SchedulePriority();
+    wxString MaxWaitCell(long item) const;
+    std::vector<Algorithm> CheckedAlgorithms() const;
+    void BuildLanes(std::vector<GanttLane> &lanes, std::vector<GanttSegment> &segments) const;
 
     wxCheckBox *m_fifoCheck;
     wxCheckBox *m_sjfCheck;
     wxCheckBox *m_srtCheck;
     wxCheckBox *m_rrCheck;
     wxCheckBox *m_priorityCheck;
+    wxCheckBox *m_mlfqCheck;
+    wxCheckBox *m_cfsCheck;
+    wxCheckBox *m_priorityPCheck;
+    wxCheckBox *m_edfCheck;
+    wxCheckBox *m_rmCheck;
     wxSpinCtrl *m_quantumSpin;
+    wxSpinCtrl *m_sweepMaxSpin;
+    wxSpinCtrl *m_sweepStepSpin;
+    wxSpinCtrl *m_cpuSpin;
+    wxChoice *m_balanceChoice;
+    wxSpinCtrl *m_mlfqLevelsSpin;
+    wxTextCtrl *m_mlfqQuantaText;
+    wxSpinCtrl *m_mlfqBoostSpin;
+    wxSpinCtrl *m_cfsLatencySpin;
+    wxSpinCtrl *m_cfsGranularitySpin;
+    wxSpinCtrl *m_agingIntervalSpin;
+    wxSpinCtrl *m_agingCapSpin;
+    wxSpinCtrl *m_horizonSpin;
+    wxButton *m_sweepBtn;
     wxButton *m_loadProcessesBtn;
     wxButton *m_startBtn;
     wxButton *m_stopBtn;
     wxButton *m_resetBtn;
-    wxListCtrl *m_processListCtrl;
+    VirtualListCtrl *m_processListCtrl;
     wxGrid *m_metricsGrid;
+    wxChoice *m_summaryChoice;
     GanttChart *m_ganttChart;
 
-    std::vector<Process> m_processes;
+    SymbolTable m_symbols; // solo crece, los IDs cargados siguen siendo validos
+    Workload m_workload;   // procesos cargados, en columnas
+
+    // Resultados de la ultima simulacion, uno por algoritmo seleccionado
+    std::vector<Algorithm> m_resultAlgorithms;
+    std::vector<ScheduleResult> m_results;
 
     wxDECLARE_EVENT_TABLE();
 };
@@ -174,26 +305,42 @@ private:
     void OnStopSimulation(wxCommandEvent &event);
     void OnResetSimulation(wxCommandEvent &event);
     void OnSyncModeChange(wxCommandEvent &event);
+    void OnSyncOptionChange(wxCommandEvent &event);
+    void OnHoldChange(wxSpinEvent &event);
+    void OnParallelismReport(wxCommandEvent &event);
+    void OnMetricsViewChange(wxCommandEvent &event);
+    void OnExportMetrics(wxCommandEvent &event);
+    void ApplySyncOptions();
+    void UpdateSyncMetrics();
     void LoadProcessesFromFile(const wxString &filename);
     void LoadResourcesFromFile(const wxString &filename);
     void LoadActionsFromFile(const wxString &filename);
     void CheckEnableStart();
 
     wxChoice *m_syncModeChoice;
+    wxChoice *m_wakeOrderChoice;
+    wxChoice *m_rwPolicyChoice;
+    wxCheckBox *m_holdBlockedCheck;
+    wxSpinCtrl *m_holdSpin;
     wxButton *m_loadProcessesBtn;
     wxButton *m_loadResourcesBtn;
     wxButton *m_loadActionsBtn;
     wxButton *m_startBtn;
     wxButton *m_stopBtn;
     wxButton *m_resetBtn;
-    wxListCtrl *m_processListCtrl;
-    wxListCtrl *m_resourceListCtrl;
-    wxListCtrl *m_actionListCtrl;
+    VirtualListCtrl *m_processListCtrl;
+    VirtualListCtrl *m_resourceListCtrl;
+    VirtualListCtrl *m_actionListCtrl;
+    wxListItemAttr m_processAttrs[6]; // estilo de las filas de procesos (paleta ciclica)
     TimelineChart *m_timelineChart;
+    wxChoice *m_metricsViewChoice; // metricas por recurso o por proceso
+    wxGrid *m_syncMetricsGrid;
 
-    std::vector<Process> m_processes;
-    std::vector<Resource> m_resources;
-    std::vector<Action> m_actions;
+    SymbolTable m_symbols; // compartida por los tres archivos; solo crece
+    Workload m_processes;
+    std::vector<SyncResource> m_resources;
+    std::vector<SyncAction> m_actions;
+    SyncActionIndex m_actionIndex; // se construye al cargar las acciones
 
     wxDECLARE_EVENT_TABLE();
 };
@@ -226,6 +373,7 @@ wxBEGIN_EVENT_TABLE(MainFrame, wxFrame)
                     wxBEGIN_EVENT_TABLE(GanttChart, wxScrolledWindow)
                         EVT_PAINT(GanttChart::OnPaint)
                             EVT_TIMER(wxID_ANY, GanttChart::OnTimer)
+                                EVT_MOUSEWHEEL(GanttChart::OnMouseWheel)
                                 wxEND_EVENT_TABLE()
 
                                     wxBEGIN_EVENT_TABLE(TimelineChart, wxScrolledWindow)
@@ -243,10 +391,24 @@ wxBEGIN_EVENT_TABLE(MainFrame, wxFrame)
                                                                                 EVT_CHECKBOX(1012, SchedulingPanel::OnAlgorithmCheck)
                                                                                     EVT_CHECKBOX(1013, SchedulingPanel::OnAlgorithmCheck)
                                                                                         EVT_CHECKBOX(1014, SchedulingPanel::OnAlgorithmCheck)
+                                                                                            EVT_CHECKBOX(1015, SchedulingPanel::OnAlgorithmCheck)
+                                                                                                EVT_CHECKBOX(1016, SchedulingPanel::OnAlgorithmCheck)
+                                                                                                    EVT_CHECKBOX(1017, SchedulingPanel::OnAlgorithmCheck)
+                                                                                                        EVT_CHECKBOX(1018, SchedulingPanel::OnAlgorithmCheck)
+                                                                                                            EVT_CHECKBOX(1019, SchedulingPanel::OnAlgorithmCheck)
 
                                                                                             EVT_SPINCTRL(1005, SchedulingPanel::OnQuantumChange)
+                                                                                                EVT_BUTTON(1006, SchedulingPanel::OnQuantumSweep)
+                                                                                                    EVT_BUTTON(1020, SchedulingPanel::OnZoomIn)
+                                                                                                        EVT_BUTTON(1021, SchedulingPanel::OnZoomOut)
+                                                                                                            EVT_BUTTON(1022, SchedulingPanel::OnZoomFit)
+                                                                                                                EVT_CHOICE(1023, SchedulingPanel::OnSummaryChange)
                                                                                                 wxEND_EVENT_TABLE()
 
+                                                                                                    wxBEGIN_EVENT_TABLE(SweepPlot, wxPanel)
+                                                                                                        EVT_PAINT(SweepPlot::OnPaint)
+                                                                                                            wxEND_EVENT_TABLE()
+
                                                                                                     wxBEGIN_EVENT_TABLE(SynchronizationPanel, wxPanel)
                                                                                                         EVT_BUTTON(2001, SynchronizationPanel::OnLoadProcesses)
                                                                                                             EVT_BUTTON(2002, SynchronizationPanel::OnLoadResources)
@@ -255,10 +417,80 @@ wxBEGIN_EVENT_TABLE(MainFrame, wxFrame)
                                                                                                                         EVT_BUTTON(2005, SynchronizationPanel::OnStopSimulation)
                                                                                                                             EVT_BUTTON(2006, SynchronizationPanel::OnResetSimulation)
                                                                                                                                 EVT_CHOICE(2007, SynchronizationPanel::OnSyncModeChange)
+                                                                                                                                    EVT_CHOICE(2008, SynchronizationPanel::OnSyncOptionChange)
+                                                                                                                                        EVT_SPINCTRL(2009, SynchronizationPanel::OnHoldChange)
+                                                                                                                                            EVT_CHOICE(2010, SynchronizationPanel::OnSyncOptionChange)
+                                                                                                                                                EVT_BUTTON(2011, SynchronizationPanel::OnParallelismReport)
+                                                                                                                                                    EVT_CHOICE(2012, SynchronizationPanel::OnMetricsViewChange)
+                                                                                                                                                        EVT_BUTTON(2013, SynchronizationPanel::OnExportMetrics)
+                                                                                                                                                            EVT_CHECKBOX(2014, SynchronizationPanel::OnSyncOptionChange)
                                                                                                                                     wxEND_EVENT_TABLE()
 
     // Implementaciones
 
+// Filtro de los dialogos de carga: CSV o formato binario (workload_binary.h)
+static const char *const kWorkloadWildcard =
+    "Archivos de carga (*.txt;*.bin)|*.txt;*.bin|Archivos de texto (*.txt)|*.txt|Archivos binarios (*.bin)|*.bin";
+
+// Texto de un ID de la tabla de simbolos para mostrarlo en la interfaz
+static wxString SymbolLabel(const SymbolTable &symbols, int id)
+{
+    return wxString::FromUTF8(symbols.Name(id).c_str());
+}
+
+// Celda de la lista de procesos: PID, BT, AT, prioridad o periodo de la fila 'item'
+static wxString ProcessCell(const SymbolTable &symbols, const Workload &procs, long item, long column)
+{
+    switch (column)
+    {
+    case 0:
+        return SymbolLabel(symbols, procs.pid[item]);
+    case 1:
+        return wxString::Format("%d", procs.burstTime[item]);
+    case 2:
+        return wxString::Format("%d", procs.arrivalTime[item]);
+    case 3:
+        return wxString::Format("%d", procs.priority[item]);
+    default:
+        return procs.period[item] > 0 ? wxString::Format("%d", procs.period[item]) : wxString("-");
+    }
+}
+
+// Color de un proceso del Gantt: paleta ciclica segun su indice
+static const size_t kProcessColourCount = 6;
+
+static wxColour ProcessColour(size_t index)
+{
+    static const wxColour colors[kProcessColourCount] = {
+        wxColour(255, 0, 0),   // Rojo
+        wxColour(0, 0, 255),   // Azul
+        wxColour(0, 255, 0),   // Verde
+        wxColour(0, 255, 255), // Cian
+        wxColour(255, 255, 0), // Amarillo
+        wxColour(255, 0, 255)  // Magenta
+    };
+    return colors[index % kProcessColourCount];
+}
+
+// Muestra en un solo mensaje las lineas omitidas por un cargador de archivos
+static void ShowLoadWarnings(const std::vector<std::string> &warnings)
+{
+    if (warnings.empty())
+        return;
+
+    const size_t maxLineas = 20; // el resto solo se cuenta
+    wxString msg = wxString::Format("Se omitieron %zu líneas inválidas:\n\n", warnings.size());
+    for (size_t i = 0; i < warnings.size() && i < maxLineas; ++i)
+    {
+        msg += wxString::FromUTF8(warnings[i].c_str()) + "\n";
+    }
+    if (warnings.size() > maxLineas)
+    {
+        msg += wxString::Format("... y %zu más.", warnings.size() - maxLineas);
+    }
+    wxMessageBox(msg, "Advertencia", wxOK | wxICON_WARNING);
+}
+
 bool OSSimulatorApp::OnInit()
 {
     try
@@ -379,12 +611,22 @@ SchedulingPanel::SchedulingPanel(wxWindow *parent) : wxPanel(parent)
     m_srtCheck = new wxCheckBox(this, 1012, "Shortest Remaining Time (SRT)");
     m_rrCheck = new wxCheckBox(this, 1013, "Round Robin (RR)");
     m_priorityCheck = new wxCheckBox(this, 1014, "Priority");
+    m_mlfqCheck = new wxCheckBox(this, 1015, "Multilevel Feedback Queue (MLFQ)");
+    m_cfsCheck = new wxCheckBox(this, 1016, "Completely Fair Scheduler (CFS)");
+    m_priorityPCheck = new wxCheckBox(this, 1017, "Priority expropiativo (aging)");
+    m_edfCheck = new wxCheckBox(this, 1018, "Earliest Deadline First (EDF)");
+    m_rmCheck = new wxCheckBox(this, 1019, "Rate Monotonic (RM)");
 
     algBox->Add(m_fifoCheck, 0, wxALL, 2);
     algBox->Add(m_sjfCheck, 0, wxALL, 2);
     algBox->Add(m_srtCheck, 0, wxALL, 2);
     algBox->Add(m_rrCheck, 0, wxALL, 2);
     algBox->Add(m_priorityCheck, 0, wxALL, 2);
+    algBox->Add(m_mlfqCheck, 0, wxALL, 2);
+    algBox->Add(m_cfsCheck, 0, wxALL, 2);
+    algBox->Add(m_priorityPCheck, 0, wxALL, 2);
+    algBox->Add(m_edfCheck, 0, wxALL, 2);
+    algBox->Add(m_rmCheck, 0, wxALL, 2);
 
     // Quantum para Round Robin
     wxStaticBoxSizer *quantumBox = new wxStaticBoxSizer(wxVERTICAL, this, "Quantum (RR)");
@@ -393,6 +635,77 @@ SchedulingPanel::SchedulingPanel(wxWindow *parent) : wxPanel(parent)
     quantumBox->Add(new wxStaticText(this, wxID_ANY, "Ciclos:"), 0, wxALL, 2);
     quantumBox->Add(m_quantumSpin, 0, wxALL, 2);
 
+    // Barrido de quantum: desde el valor de arriba hasta "Hasta" con el paso indicado
+    m_sweepMaxSpin = new wxSpinCtrl(this, wxID_ANY, "20", wxDefaultPosition, wxDefaultSize,
+                                    wxSP_ARROW_KEYS, 3, 1000, 20);
+    m_sweepStepSpin = new wxSpinCtrl(this, wxID_ANY, "1", wxDefaultPosition, wxDefaultSize,
+                                     wxSP_ARROW_KEYS, 1, 100, 1);
+    m_sweepBtn = new wxButton(this, 1006, "Barrido de Quantum");
+    m_sweepBtn->Enable(false);
+    quantumBox->Add(new wxStaticText(this, wxID_ANY, "Barrido hasta:"), 0, wxALL, 2);
+    quantumBox->Add(m_sweepMaxSpin, 0, wxALL, 2);
+    quantumBox->Add(new wxStaticText(this, wxID_ANY, "Paso:"), 0, wxALL, 2);
+    quantumBox->Add(m_sweepStepSpin, 0, wxALL, 2);
+    quantumBox->Add(m_sweepBtn, 0, wxEXPAND | wxALL, 2);
+
+    // MLFQ: niveles, quantum de cada nivel y periodo de la subida al nivel 0
+    wxStaticBoxSizer *mlfqBox = new wxStaticBoxSizer(wxVERTICAL, this, "MLFQ");
+    m_mlfqLevelsSpin = new wxSpinCtrl(this, wxID_ANY, "3", wxDefaultPosition, wxDefaultSize,
+                                      wxSP_ARROW_KEYS, 1, kMaxMlfqLevels, 3);
+    m_mlfqQuantaText = new wxTextCtrl(this, wxID_ANY, "2,4,8");
+    m_mlfqBoostSpin = new wxSpinCtrl(this, wxID_ANY, "50", wxDefaultPosition, wxDefaultSize,
+                                     wxSP_ARROW_KEYS, 0, 100000, 50);
+    mlfqBox->Add(new wxStaticText(this, wxID_ANY, "Niveles:"), 0, wxALL, 2);
+    mlfqBox->Add(m_mlfqLevelsSpin, 0, wxALL, 2);
+    mlfqBox->Add(new wxStaticText(this, wxID_ANY, "Quantum por nivel:"), 0, wxALL, 2);
+    mlfqBox->Add(m_mlfqQuantaText, 0, wxEXPAND | wxALL, 2);
+    mlfqBox->Add(new wxStaticText(this, wxID_ANY, "Subida cada (0 = nunca):"), 0, wxALL, 2);
+    mlfqBox->Add(m_mlfqBoostSpin, 0, wxALL, 2);
+
+    // CFS: periodo en que todos los listos corren una vez y turno minimo
+    wxStaticBoxSizer *cfsBox = new wxStaticBoxSizer(wxVERTICAL, this, "CFS");
+    m_cfsLatencySpin = new wxSpinCtrl(this, wxID_ANY, "24", wxDefaultPosition, wxDefaultSize,
+                                      wxSP_ARROW_KEYS, 1, 10000, 24);
+    m_cfsGranularitySpin = new wxSpinCtrl(this, wxID_ANY, "3", wxDefaultPosition, wxDefaultSize,
+                                          wxSP_ARROW_KEYS, 1, 1000, 3);
+    cfsBox->Add(new wxStaticText(this, wxID_ANY, "Latencia objetivo:"), 0, wxALL, 2);
+    cfsBox->Add(m_cfsLatencySpin, 0, wxALL, 2);
+    cfsBox->Add(new wxStaticText(this, wxID_ANY, "Granularidad minima:"), 0, wxALL, 2);
+    cfsBox->Add(m_cfsGranularitySpin, 0, wxALL, 2);
+
+    // Envejecimiento de la prioridad expropiativa: ritmo y tope
+    wxStaticBoxSizer *agingBox = new wxStaticBoxSizer(wxVERTICAL, this, "Aging (Priority)");
+    m_agingIntervalSpin = new wxSpinCtrl(this, wxID_ANY, "5", wxDefaultPosition, wxDefaultSize,
+                                         wxSP_ARROW_KEYS, 0, 100000, 5);
+    m_agingCapSpin = new wxSpinCtrl(this, wxID_ANY, "0", wxDefaultPosition, wxDefaultSize,
+                                    wxSP_ARROW_KEYS, -100000, 100000, 0);
+    agingBox->Add(new wxStaticText(this, wxID_ANY, "Ciclos por nivel (0 = sin aging):"), 0, wxALL, 2);
+    agingBox->Add(m_agingIntervalSpin, 0, wxALL, 2);
+    agingBox->Add(new wxStaticText(this, wxID_ANY, "Prioridad maxima:"), 0, wxALL, 2);
+    agingBox->Add(m_agingCapSpin, 0, wxALL, 2);
+
+    // Tiempo real: hasta que ciclo liberan trabajos las tareas periodicas
+    wxStaticBoxSizer *realtimeBox = new wxStaticBoxSizer(wxVERTICAL, this, "Tiempo real (EDF/RM)");
+    m_horizonSpin = new wxSpinCtrl(this, wxID_ANY, "0", wxDefaultPosition, wxDefaultSize,
+                                   wxSP_ARROW_KEYS, 0, kMaxAutoHorizon, 0);
+    realtimeBox->Add(new wxStaticText(this, wxID_ANY, "Horizonte (0 = hiperperiodo):"), 0, wxALL, 2);
+    realtimeBox->Add(m_horizonSpin, 0, wxALL, 2);
+
+    // Multiprocesador: numero de CPUs y reparto de la carga entre sus colas
+    wxStaticBoxSizer *smpBox = new wxStaticBoxSizer(wxVERTICAL, this, "Multiprocesador (SMP)");
+    m_cpuSpin = new wxSpinCtrl(this, wxID_ANY, "1", wxDefaultPosition, wxDefaultSize,
+                               wxSP_ARROW_KEYS, 1, kMaxCpus, 1);
+    wxArrayString balanceos;
+    balanceos.Add("Cola global");
+    balanceos.Add("Migracion (push)");
+    balanceos.Add("Robo de trabajo");
+    m_balanceChoice = new wxChoice(this, wxID_ANY, wxDefaultPosition, wxDefaultSize, balanceos);
+    m_balanceChoice->SetSelection(2);
+    smpBox->Add(new wxStaticText(this, wxID_ANY, "CPUs:"), 0, wxALL, 2);
+    smpBox->Add(m_cpuSpin, 0, wxALL, 2);
+    smpBox->Add(new wxStaticText(this, wxID_ANY, "Balanceo:"), 0, wxALL, 2);
+    smpBox->Add(m_balanceChoice, 0, wxEXPAND | wxALL, 2);
+
     // Botones de control
     wxStaticBoxSizer *btnBox = new wxStaticBoxSizer(wxVERTICAL, this, "Control");
     m_loadProcessesBtn = new wxButton(this, 1001, "Cargar Procesos");
@@ -410,6 +723,11 @@ SchedulingPanel::SchedulingPanel(wxWindow *parent) : wxPanel(parent)
 
     controlBox->Add(algBox, 1, wxEXPAND | wxALL, 5);
     controlBox->Add(quantumBox, 0, wxEXPAND | wxALL, 5);
+    controlBox->Add(mlfqBox, 0, wxEXPAND | wxALL, 5);
+    controlBox->Add(cfsBox, 0, wxEXPAND | wxALL, 5);
+    controlBox->Add(agingBox, 0, wxEXPAND | wxALL, 5);
+    controlBox->Add(realtimeBox, 0, wxEXPAND | wxALL, 5);
+    controlBox->Add(smpBox, 0, wxEXPAND | wxALL, 5);
     controlBox->Add(btnBox, 0, wxEXPAND | wxALL, 5);
 
     // Panel de informacion
@@ -417,26 +735,39 @@ SchedulingPanel::SchedulingPanel(wxWindow *parent) : wxPanel(parent)
 
     // Lista de procesos
     wxStaticBoxSizer *processBox = new wxStaticBoxSizer(wxVERTICAL, this, "Procesos Cargados");
-    m_processListCtrl = new wxListCtrl(this, wxID_ANY, wxDefaultPosition, wxSize(300, 150),
-                                       wxLC_REPORT | wxLC_SINGLE_SEL);
+    m_processListCtrl = new VirtualListCtrl(this, wxSize(300, 150), [this](long item, long column)
+                                            { return column == 5 ? MaxWaitCell(item)
+                                                                 : ProcessCell(m_symbols, m_workload, item, column); });
     m_processListCtrl->AppendColumn("PID", wxLIST_FORMAT_LEFT, 60);
     m_processListCtrl->AppendColumn("BT", wxLIST_FORMAT_RIGHT, 60);
     m_processListCtrl->AppendColumn("AT", wxLIST_FORMAT_RIGHT, 60);
     m_processListCtrl->AppendColumn("Priority", wxLIST_FORMAT_RIGHT, 80);
+    m_processListCtrl->AppendColumn("Periodo", wxLIST_FORMAT_RIGHT, 70);
+    m_processListCtrl->AppendColumn("Espera max.", wxLIST_FORMAT_RIGHT, 100);
     processBox->Add(m_processListCtrl, 1, wxEXPAND | wxALL, 2);
 
     // Metricas
     wxStaticBoxSizer *metricsBox = new wxStaticBoxSizer(wxVERTICAL, this, "Metricas de Eficiencia");
     m_metricsGrid = new wxGrid(this, wxID_ANY, wxDefaultPosition, wxSize(300, 150));
-    m_metricsGrid->CreateGrid(3, 2);
+    m_metricsGrid->CreateGrid(8, 2);
     m_metricsGrid->SetColLabelValue(0, "Metrica");
     m_metricsGrid->SetColLabelValue(1, "Valor");
     m_metricsGrid->SetRowLabelValue(0, "1");
     m_metricsGrid->SetRowLabelValue(1, "2");
     m_metricsGrid->SetRowLabelValue(2, "3");
+    m_metricsGrid->SetRowLabelValue(3, "4");
+    m_metricsGrid->SetRowLabelValue(4, "5");
+    m_metricsGrid->SetRowLabelValue(5, "6");
+    m_metricsGrid->SetRowLabelValue(6, "7");
+    m_metricsGrid->SetRowLabelValue(7, "8");
     m_metricsGrid->SetCellValue(0, 0, "Avg Waiting Time");
     m_metricsGrid->SetCellValue(1, 0, "Avg Turnaround Time");
     m_metricsGrid->SetCellValue(2, 0, "Throughput");
+    m_metricsGrid->SetCellValue(3, 0, "Max Waiting Time");
+    m_metricsGrid->SetCellValue(4, 0, "Migraciones");
+    m_metricsGrid->SetCellValue(5, 0, "Deadlines perdidos");
+    m_metricsGrid->SetCellValue(6, 0, "Max lateness");
+    m_metricsGrid->SetCellValue(7, 0, "Utilizacion / cota");
     m_metricsGrid->EnableEditing(false);
     metricsBox->Add(m_metricsGrid, 1, wxEXPAND | wxALL, 2);
 
@@ -446,6 +777,21 @@ SchedulingPanel::SchedulingPanel(wxWindow *parent) : wxPanel(parent)
     // Grafico Gantt
     wxStaticBoxSizer *ganttBox = new wxStaticBoxSizer(wxVERTICAL, this, "Diagrama de Gantt");
     m_ganttChart = new GanttChart(this);
+
+    // Zoom (tambien Ctrl + rueda sobre el diagrama) y resumen de la vista alejada
+    wxBoxSizer *zoomSizer = new wxBoxSizer(wxHORIZONTAL);
+    zoomSizer->Add(new wxButton(this, 1020, "Acercar"), 0, wxALL, 2);
+    zoomSizer->Add(new wxButton(this, 1021, "Alejar"), 0, wxALL, 2);
+    zoomSizer->Add(new wxButton(this, 1022, "Ajustar"), 0, wxALL, 2);
+    zoomSizer->Add(new wxStaticText(this, wxID_ANY, "Vista alejada:"), 0, wxALIGN_CENTER_VERTICAL | wxLEFT, 10);
+    wxArrayString resumenes;
+    resumenes.Add("Proceso dominante");
+    resumenes.Add("Ocupacion");
+    m_summaryChoice = new wxChoice(this, 1023, wxDefaultPosition, wxDefaultSize, resumenes);
+    m_summaryChoice->SetSelection(0);
+    zoomSizer->Add(m_summaryChoice, 0, wxALL, 2);
+
+    ganttBox->Add(zoomSizer, 0, wxALL, 0);
     ganttBox->Add(m_ganttChart, 1, wxEXPAND | wxALL, 2);
 
     // CORRECCION: Agregar titulo al layout principal
@@ -479,11 +825,40 @@ SynchronizationPanel::SynchronizationPanel(wxWindow *parent) : wxPanel(parent)
     wxArrayString syncChoices;
     syncChoices.Add("Mutex Locks");
     syncChoices.Add("Semaforos");
+    syncChoices.Add("Lectores/Escritores");
     m_syncModeChoice = new wxChoice(this, 2007, wxDefaultPosition, wxDefaultSize, syncChoices);
     m_syncModeChoice->SetSelection(0);
     syncBox->Add(new wxStaticText(this, wxID_ANY, "Tipo:"), 0, wxALL, 2);
     syncBox->Add(m_syncModeChoice, 0, wxEXPAND | wxALL, 2);
 
+    // Cola de espera de cada recurso y ciclos que se retiene cada unidad
+    wxArrayString wakeChoices;
+    wakeChoices.Add("FIFO");
+    wakeChoices.Add("Prioridad del proceso");
+    m_wakeOrderChoice = new wxChoice(this, 2008, wxDefaultPosition, wxDefaultSize, wakeChoices);
+    m_wakeOrderChoice->SetSelection(0);
+    m_holdSpin = new wxSpinCtrl(this, 2009, "1", wxDefaultPosition, wxDefaultSize,
+                                wxSP_ARROW_KEYS, 1, 100, 1);
+    syncBox->Add(new wxStaticText(this, wxID_ANY, "Cola de espera:"), 0, wxALL, 2);
+    syncBox->Add(m_wakeOrderChoice, 0, wxEXPAND | wxALL, 2);
+    syncBox->Add(new wxStaticText(this, wxID_ANY, "Retencion (ciclos):"), 0, wxALL, 2);
+    syncBox->Add(m_holdSpin, 0, wxEXPAND | wxALL, 2);
+
+    // Retener lo obtenido mientras se espera otro recurso: permite interbloqueos
+    m_holdBlockedCheck = new wxCheckBox(this, 2014, "Retener mientras espera (detectar interbloqueos)");
+    syncBox->Add(m_holdBlockedCheck, 0, wxALL, 2);
+
+    // Politica de lectores/escritores (solo en ese modo)
+    wxArrayString rwChoices;
+    rwChoices.Add("Preferencia a lectores");
+    rwChoices.Add("Preferencia a escritores");
+    rwChoices.Add("Justa (orden de llegada)");
+    m_rwPolicyChoice = new wxChoice(this, 2010, wxDefaultPosition, wxDefaultSize, rwChoices);
+    m_rwPolicyChoice->SetSelection(2);
+    m_rwPolicyChoice->Enable(false);
+    syncBox->Add(new wxStaticText(this, wxID_ANY, "Politica L/E:"), 0, wxALL, 2);
+    syncBox->Add(m_rwPolicyChoice, 0, wxEXPAND | wxALL, 2);
+
     // Botones de carga
     wxStaticBoxSizer *loadBox = new wxStaticBoxSizer(wxVERTICAL, this, "Carga de Archivos");
     m_loadProcessesBtn = new wxButton(this, 2001, "Cargar Procesos");
@@ -505,6 +880,7 @@ SynchronizationPanel::SynchronizationPanel(wxWindow *parent) : wxPanel(parent)
     btnBox->Add(m_startBtn, 0, wxEXPAND | wxALL, 2);
     btnBox->Add(m_stopBtn, 0, wxEXPAND | wxALL, 2);
     btnBox->Add(m_resetBtn, 0, wxEXPAND | wxALL, 2);
+    btnBox->Add(new wxButton(this, 2011, "Paralelismo..."), 0, wxEXPAND | wxALL, 2);
 
     controlBox->Add(syncBox, 1, wxEXPAND | wxALL, 5);
     controlBox->Add(loadBox, 1, wxEXPAND | wxALL, 5);
@@ -515,8 +891,32 @@ SynchronizationPanel::SynchronizationPanel(wxWindow *parent) : wxPanel(parent)
 
     // Lista de procesos
     wxStaticBoxSizer *processBox = new wxStaticBoxSizer(wxVERTICAL, this, "Procesos");
-    m_processListCtrl = new wxListCtrl(this, wxID_ANY, wxDefaultPosition, wxSize(200, 120),
-                                       wxLC_REPORT | wxLC_SINGLE_SEL);
+    m_processListCtrl = new VirtualListCtrl(this, wxSize(200, 120), [this](long item, long column)
+                                            { return ProcessCell(m_symbols, m_processes, item, column); },
+                                            [this](long item)
+                                            { return &m_processAttrs[item % 6]; });
+
+    // Estilo de las filas: fondo pastel, texto oscuro del mismo tono y PID en negrita
+    const wxColour pastelBackgrounds[6] = {
+        wxColour(255, 230, 230), // rosa suave
+        wxColour(230, 230, 255), // azul suave
+        wxColour(230, 255, 230), // verde suave
+        wxColour(230, 255, 255), // cian suave
+        wxColour(255, 255, 230), // amarillo suave
+        wxColour(255, 230, 255)  // magenta suave
+    };
+    const wxColour textColours[6] = {
+        wxColour(150, 0, 0),   // rojo oscuro
+        wxColour(0, 0, 150),   // azul oscuro
+        wxColour(0, 150, 0),   // verde oscuro
+        wxColour(0, 150, 150), // cian oscuro
+        wxColour(150, 150, 0), // amarillo oscuro
+        wxColour(150, 0, 150)  // magenta oscuro
+    };
+    wxFont boldFont = m_processListCtrl->GetFont();
+    boldFont.SetWeight(wxFONTWEIGHT_BOLD);
+    for (int i = 0; i < 6; ++i)
+        m_processAttrs[i] = wxListItemAttr(textColours[i], pastelBackgrounds[i], boldFont);
     m_processListCtrl->AppendColumn("PID", wxLIST_FORMAT_LEFT, 60);
     m_processListCtrl->AppendColumn("BT", wxLIST_FORMAT_RIGHT, 50);
     m_processListCtrl->AppendColumn("AT", wxLIST_FORMAT_RIGHT, 50);
@@ -525,16 +925,30 @@ SynchronizationPanel::SynchronizationPanel(wxWindow *parent) : wxPanel(parent)
 
     // Lista de recursos
     wxStaticBoxSizer *resourceBox = new wxStaticBoxSizer(wxVERTICAL, this, "Recursos");
-    m_resourceListCtrl = new wxListCtrl(this, wxID_ANY, wxDefaultPosition, wxSize(200, 120),
-                                        wxLC_REPORT | wxLC_SINGLE_SEL);
+    m_resourceListCtrl = new VirtualListCtrl(this, wxSize(200, 120), [this](long item, long column)
+                                             {
+        const SyncResource &r = m_resources[item];
+        return column == 0 ? SymbolLabel(m_symbols, r.name) : wxString::Format("%d", r.counter); });
     m_resourceListCtrl->AppendColumn("Recurso", wxLIST_FORMAT_LEFT, 100);
     m_resourceListCtrl->AppendColumn("Contador", wxLIST_FORMAT_RIGHT, 80);
     resourceBox->Add(m_resourceListCtrl, 1, wxEXPAND | wxALL, 2);
 
     // Lista de acciones
     wxStaticBoxSizer *actionBox = new wxStaticBoxSizer(wxVERTICAL, this, "Acciones");
-    m_actionListCtrl = new wxListCtrl(this, wxID_ANY, wxDefaultPosition, wxSize(250, 120),
-                                      wxLC_REPORT | wxLC_SINGLE_SEL);
+    m_actionListCtrl = new VirtualListCtrl(this, wxSize(250, 120), [this](long item, long column)
+                                           {
+        const SyncAction &a = m_actions[item];
+        switch (column)
+        {
+        case 0:
+            return SymbolLabel(m_symbols, a.pid);
+        case 1:
+            return SymbolLabel(m_symbols, a.action);
+        case 2:
+            return SymbolLabel(m_symbols, a.resource);
+        default:
+            return wxString::Format("%d", a.cycle);
+        } });
     m_actionListCtrl->AppendColumn("PID", wxLIST_FORMAT_LEFT, 50);
     m_actionListCtrl->AppendColumn("Accion", wxLIST_FORMAT_LEFT, 70);
     m_actionListCtrl->AppendColumn("Recurso", wxLIST_FORMAT_LEFT, 70);
@@ -550,26 +964,84 @@ SynchronizationPanel::SynchronizationPanel(wxWindow *parent) : wxPanel(parent)
     m_timelineChart = new TimelineChart(this);
     timelineBox->Add(m_timelineChart, 1, wxEXPAND | wxALL, 2);
 
+    // Metricas de contencion de la ultima simulacion: los recursos o procesos
+    // con mas espera (el archivo exportado los incluye todos)
+    wxStaticBoxSizer *metricsBox = new wxStaticBoxSizer(wxVERTICAL, this, "Metricas");
+    wxArrayString metricsViews;
+    metricsViews.Add("Por recurso");
+    metricsViews.Add("Por proceso");
+    m_metricsViewChoice = new wxChoice(this, 2012, wxDefaultPosition, wxDefaultSize, metricsViews);
+    m_metricsViewChoice->SetSelection(0);
+    m_syncMetricsGrid = new wxGrid(this, wxID_ANY, wxDefaultPosition, wxSize(420, 150));
+    m_syncMetricsGrid->CreateGrid(0, 8);
+    m_syncMetricsGrid->EnableEditing(false);
+    m_syncMetricsGrid->SetRowLabelSize(40);
+    metricsBox->Add(m_metricsViewChoice, 0, wxEXPAND | wxALL, 2);
+    metricsBox->Add(m_syncMetricsGrid, 1, wxEXPAND | wxALL, 2);
+    metricsBox->Add(new wxButton(this, 2013, "Exportar..."), 0, wxEXPAND | wxALL, 2);
+
+    wxBoxSizer *resultSizer = new wxBoxSizer(wxHORIZONTAL);
+    resultSizer->Add(timelineBox, 3, wxEXPAND | wxALL, 0);
+    resultSizer->Add(metricsBox, 2, wxEXPAND | wxLEFT, 5);
+
+    // Las metricas se recalculan con cada simulacion
+    m_timelineChart->SetSimulatedHandler([this]()
+                                         { UpdateSyncMetrics(); });
+    UpdateSyncMetrics();
+
     // CORRECCION: Agregar titulo al layout principal
     wxBoxSizer *mainSizer = new wxBoxSizer(wxVERTICAL);
     mainSizer->Add(titleText, 0, wxEXPAND | wxALL, 10);
     mainSizer->Add(controlBox, 0, wxEXPAND | wxALL, 5);
     mainSizer->Add(infoBox, 0, wxEXPAND | wxALL, 5);
-    mainSizer->Add(timelineBox, 1, wxEXPAND | wxALL, 5);
+    mainSizer->Add(resultSizer, 1, wxEXPAND | wxALL, 5);
 
     SetSizer(mainSizer);
 }
 
-GanttChart::GanttChart(wxWindow *parent) : wxScrolledWindow(parent),
-                                           m_currentCycle(0), m_isRunning(false)
+GanttChart::GanttChart(wxWindow *parent) : wxScrolledWindow(parent), m_workload(nullptr), m_symbols(nullptr),
+                                           m_currentCycle(0), m_lastCycle(0), m_isRunning(false),
+                                           m_scale(kDefaultPxPerCycle), m_summary(GanttSummary::Dominant), m_bufferValid(false),
+                                           m_pendingBrush(wxColour(200, 200, 200)), m_pendingPen(*wxLIGHT_GREY, 1)
 {
     m_timer = new wxTimer(this);
-    SetScrollbars(20, 20, 100, 50);
+    SetScrollbars(kScrollUnit, kScrollUnit, 100, 50);
     SetBackgroundColour(*wxWHITE);
+    SetBackgroundStyle(wxBG_STYLE_PAINT); // el fondo lo pinta OnPaint en el buffer
+
+    for (size_t i = 0; i < kProcessColourCount; ++i)
+    {
+        wxColour color = ProcessColour(i);
+        m_processBrushes.push_back(wxBrush(color));
+        m_processPens.push_back(wxPen(color.ChangeLightness(80), 2));
+    }
+}
+
+VirtualListCtrl::VirtualListCtrl(wxWindow *parent, const wxSize &size, TextFn text, AttrFn attr)
+    : wxListCtrl(parent, wxID_ANY, wxDefaultPosition, size, wxLC_REPORT | wxLC_SINGLE_SEL | wxLC_VIRTUAL),
+      m_text(std::move(text)), m_attr(std::move(attr))
+{
 }
 
-TimelineChart::TimelineChart(wxWindow *parent) : wxScrolledWindow(parent),
-                                                 m_currentCycle(0), m_isRunning(false)
+void VirtualListCtrl::SetRowCount(size_t rows)
+{
+    SetItemCount(static_cast<long>(rows));
+    Refresh();
+}
+
+wxString VirtualListCtrl::OnGetItemText(long item, long column) const
+{
+    return m_text(item, column);
+}
+
+wxListItemAttr *VirtualListCtrl::OnGetItemAttr(long item) const
+{
+    return m_attr ? m_attr(item) : nullptr;
+}
+
+TimelineChart::TimelineChart(wxWindow *parent) : wxScrolledWindow(parent), m_processes(nullptr), m_resources(nullptr),
+                                                 m_actions(nullptr), m_actionIndex(nullptr), m_symbols(nullptr), m_currentCycle(0),
+                                                 m_isRunning(false), m_readId(-1)
 {
     m_timer = new wxTimer(this);
     SetScrollbars(20, 20, 100, 50);
@@ -586,7 +1058,7 @@ void MainFrame::OnAbout(wxCommandEvent &event)
 void SchedulingPanel::OnLoadProcesses(wxCommandEvent &event)
 {
     wxFileDialog dialog(this, "Seleccionar archivo de procesos", "", "",
-                        "Archivos de texto (*.txt)|*.txt", wxFD_OPEN | wxFD_FILE_MUST_EXIST);
+                        kWorkloadWildcard, wxFD_OPEN | wxFD_FILE_MUST_EXIST);
     if (dialog.ShowModal() == wxID_OK)
     {
         LoadProcessesFromFile(dialog.GetPath());
@@ -595,26 +1067,47 @@ void SchedulingPanel::OnLoadProcesses(wxCommandEvent &event)
 
 void SchedulingPanel::OnStartSimulation(wxCommandEvent &event)
 {
-    if (m_fifoCheck->GetValue())
-    {
-        ScheduleFIFO();
-    }
-    else if (m_sjfCheck->GetValue())
-    {
-        ScheduleSJF();
-    }
-    else if (m_srtCheck->GetValue())
+    std::vector<Algorithm> algs = CheckedAlgorithms();
+    if (algs.empty())
+        return;
+    if (m_workload.Empty())
     {
-        ScheduleSRT();
+        wxMessageBox("No hay procesos cargados.", "Atención", wxICON_INFORMATION);
+        return;
     }
-    else if (m_rrCheck->GetValue())
+
+    // Ejecutar todos los algoritmos marcados a la vez en el grupo de hilos del motor
+    SchedulerOptions options;
+    options.quantum = m_quantumSpin->GetValue();
+    options.symbols = &m_symbols;
+    options.cpus = m_cpuSpin->GetValue();
+    static const LoadBalance balanceos[] = {LoadBalance::Global, LoadBalance::Push, LoadBalance::WorkStealing};
+    options.balance = balanceos[std::max(0, m_balanceChoice->GetSelection())];
+    options.mlfqLevels = m_mlfqLevelsSpin->GetValue();
+    options.mlfqBoost = m_mlfqBoostSpin->GetValue();
+    options.cfsTargetLatency = m_cfsLatencySpin->GetValue();
+    options.cfsMinGranularity = m_cfsGranularitySpin->GetValue();
+    options.agingInterval = m_agingIntervalSpin->GetValue();
+    options.agingCap = m_agingCapSpin->GetValue();
+    options.realtimeHorizon = m_horizonSpin->GetValue();
+    if (!ParseQuantumList(m_mlfqQuantaText->GetValue().ToStdString(), options.mlfqQuanta))
     {
-        ScheduleRR();
+        wxMessageBox("El quantum por nivel de MLFQ debe ser una lista de enteros positivos separados por coma (p. ej. 2,4,8).",
+                     "Atención", wxICON_WARNING);
+        return;
     }
-    else if (m_priorityCheck->GetValue())
     {
-        SchedulePriority();
+        wxBusyCursor espera;
+        m_results = RunSchedulers(algs, m_workload, options);
     }
+    m_resultAlgorithms = algs;
+
+    UpdateMetrics();
+    std::vector<GanttLane> lanes;
+    std::vector<GanttSegment> segments;
+    BuildLanes(lanes, segments);
+    m_ganttChart->SetLanes(std::move(lanes), std::move(segments));
+    m_ganttChart->ResetChart();
 
     m_ganttChart->StartSimulation();
     m_startBtn->Enable(false);
@@ -631,804 +1124,519 @@ void SchedulingPanel::OnStopSimulation(wxCommandEvent &event)
 void SchedulingPanel::OnResetSimulation(wxCommandEvent &event)
 {
     m_ganttChart->ResetChart();
-    m_startBtn->Enable(!m_processes.empty());
+    m_startBtn->Enable(!m_workload.Empty());
     m_stopBtn->Enable(false);
 }
 
 void SchedulingPanel::OnAlgorithmCheck(wxCommandEvent &event)
 {
-    // 1) Si selecciona FIFO, deseleccionar los demás (opcional)
-    if (event.GetId() == 1010 && m_fifoCheck->GetValue())
-    {
-        // Desmarcar SJF, SRT, RR, Priority (si no quieres que se mezclen)
-        m_sjfCheck->SetValue(false);
-        m_srtCheck->SetValue(false);
-        m_rrCheck->SetValue(false);
-        m_priorityCheck->SetValue(false);
-    }
-    // … Similar para los demás checkboxes, si solo permites uno a la vez …
-
-    // 2) Habilitar o deshabilitar el botón “Iniciar Simulación”
-    bool anySelected = m_fifoCheck->GetValue() || m_sjfCheck->GetValue() || m_srtCheck->GetValue() || m_rrCheck->GetValue() || m_priorityCheck->GetValue();
-    m_startBtn->Enable(anySelected && !m_processes.empty());
+    // Se pueden marcar varios algoritmos: todos se ejecutan y se comparan.
+    // Habilitar o deshabilitar el botón “Iniciar Simulación”
+    m_startBtn->Enable(!CheckedAlgorithms().empty() && !m_workload.Empty());
 }
 
 void SchedulingPanel::OnQuantumChange(wxSpinEvent &event)
 {
-    // Actualizar quantum para Round Robin
+    // El quantum de Round Robin es tambien el inicio del barrido: el limite no puede ser menor
+    m_sweepMaxSpin->SetRange(m_quantumSpin->GetValue(), 1000);
 }
 
-void SchedulingPanel::LoadProcessesFromFile(const wxString &filename)
+void SchedulingPanel::OnQuantumSweep(wxCommandEvent &event)
 {
-    m_processListCtrl->DeleteAllItems();
-    m_processes.clear();
-
-    std::ifstream file(filename.ToStdString());
-    if (!file.is_open())
+    if (m_workload.Empty())
     {
-        wxMessageBox("No se pudo abrir el archivo de procesos.", "Error", wxOK | wxICON_ERROR);
+        wxMessageBox("No hay procesos cargados.", "Atención", wxICON_INFORMATION);
         return;
     }
 
-    std::string line;
-    // Paleta de colores para cada proceso
-    std::vector<wxColour> colors = {
-        wxColour(255, 0, 0),   // Rojo
-        wxColour(0, 0, 255),   // Azul
-        wxColour(0, 255, 0),   // Verde
-        wxColour(0, 255, 255), // Cian
-        wxColour(255, 255, 0), // Amarillo
-        wxColour(255, 0, 255)  // Magenta
-    };
-    int colorIndex = 0;
+    int desde = m_quantumSpin->GetValue();
+    int hasta = m_sweepMaxSpin->GetValue();
+    int paso = m_sweepStepSpin->GetValue();
+    if (hasta < desde)
+    {
+        wxMessageBox("El limite del barrido debe ser mayor o igual al quantum.",
+                     "Atención", wxOK | wxICON_WARNING);
+        return;
+    }
 
-    while (std::getline(file, line))
+    // Una corrida de Round Robin por quantum, repartidas entre todos los nucleos
+    std::vector<QuantumSweepPoint> points;
     {
-        if (line.empty())
-            continue; // saltar líneas en blanco
+        wxBusyCursor espera;
+        points = SweepRoundRobin(m_workload, desde, hasta, paso);
+    }
 
-        std::stringstream ss(line);
-        std::string pid_str, bt_str, at_str, prio_str;
+    QuantumSweepDialog dialog(this, points);
+    dialog.ShowModal();
+}
 
-        // Leer cada campo con getline y coma como separador
-        std::getline(ss, pid_str, ',');
-        std::getline(ss, bt_str, ',');
-        std::getline(ss, at_str, ',');
-        std::getline(ss, prio_str, ',');
+void SchedulingPanel::OnZoomIn(wxCommandEvent &event)
+{
+    m_ganttChart->ZoomIn();
+}
 
-        // Eliminar espacios al inicio y al final de cada string
-        auto trim = [&](std::string &s)
-        {
-            // trim left
-            s.erase(0, s.find_first_not_of(" \t\r\n"));
-            // trim right
-            s.erase(s.find_last_not_of(" \t\r\n") + 1);
-        };
-        trim(pid_str);
-        trim(bt_str);
-        trim(at_str);
-        trim(prio_str);
-
-        // Convertir a enteros
-        int bt = std::stoi(bt_str);
-        int at = std::stoi(at_str);
-        int prio = std::stoi(prio_str);
-
-        // Elegir color cíclicamente
-        wxColour color = colors[colorIndex++ % colors.size()];
-        Process p;
-        p.pid = wxString(pid_str);
-        p.burstTime = bt;
-        p.arrivalTime = at;
-        p.priority = prio;
-        p.color = color;
-        p.startTime = 0;
-        p.finishTime = 0;
-        p.waitingTime = 0;
-
-        m_processes.push_back(p);
-    }
-
-    // Actualizar el wxListCtrl de la vista
-    for (size_t i = 0; i < m_processes.size(); ++i)
-    {
-        long index = m_processListCtrl->InsertItem(i, m_processes[i].pid);
-        m_processListCtrl->SetItem(index, 1, wxString::Format("%d", m_processes[i].burstTime));
-        m_processListCtrl->SetItem(index, 2, wxString::Format("%d", m_processes[i].arrivalTime));
-        m_processListCtrl->SetItem(index, 3, wxString::Format("%d", m_processes[i].priority));
-    }
+void SchedulingPanel::OnZoomOut(wxCommandEvent &event)
+{
+    m_ganttChart->ZoomOut();
+}
 
-    // Activar botón “Iniciar” si ya hay procesos y al menos un algoritmo está seleccionado
-    bool anyAlgSelected = m_fifoCheck->GetValue() ||
-                          m_sjfCheck->GetValue() ||
-                          m_srtCheck->GetValue() ||
-                          m_rrCheck->GetValue() ||
-                          m_priorityCheck->GetValue();
-    m_startBtn->Enable(anyAlgSelected && !m_processes.empty());
-
-    // Pasarle los procesos al Gantt (para la vista gráfica)
-    m_ganttChart->SetProcesses(m_processes);
-    UpdateMetrics();
+void SchedulingPanel::OnZoomFit(wxCommandEvent &event)
+{
+    m_ganttChart->ZoomToFit();
 }
 
-void SchedulingPanel::ScheduleFIFO()
+void SchedulingPanel::OnSummaryChange(wxCommandEvent &event)
 {
-    // 1) Si no hay procesos cargados, salimos.
-    if (m_processes.empty())
-    {
-        wxMessageBox("No hay procesos cargados.", "Atención", wxICON_INFORMATION);
-        return;
-    }
+    m_ganttChart->SetSummary(m_summaryChoice->GetSelection() == 1 ? GanttSummary::Occupancy
+                                                                   : GanttSummary::Dominant);
+}
 
-    // 2) Crear un vector de punteros a Process para actualizar directamente m_processes.
-    std::vector<Process *> ptrs;
-    ptrs.reserve(m_processes.size());
-    for (auto &p : m_processes)
-    {
-        ptrs.push_back(&p);
-    }
+void SchedulingPanel::LoadProcessesFromFile(const wxString &filename)
+{
+    m_processListCtrl->SetRowCount(0);
 
-    // 3) Ordenar los punteros por arrivalTime (FIFO). En caso de empate, desempatar por PID.
-    std::sort(ptrs.begin(), ptrs.end(), [](const Process *a, const Process *b)
-              {
- if (a->arrivalTime != b->arrivalTime) {
- return a->arrivalTime < b->arrivalTime;
- }
- return a->pid < b->pid; });
+    // Descartar resultados y carriles antes de reemplazar los procesos que referencian
+    m_results.clear();
+    m_resultAlgorithms.clear();
+    m_ganttChart->SetProcesses(&m_workload, &m_symbols);
 
-    // 4) Recorrer en orden y calcular startTime/finishTime/waitingTime directamente sobre m_processes
-    int currentCycle = 0;
-    for (auto *p : ptrs)
+    std::vector<std::string> warnings;
+    bool abierto = LoadProcessFile(filename.ToStdString(), m_symbols, m_workload, warnings);
+    if (!abierto)
     {
-        int inicio = std::max(currentCycle, p->arrivalTime);
-        p->startTime = inicio;
-        p->finishTime = inicio + p->burstTime;
-        p->waitingTime = p->startTime - p->arrivalTime;
-        currentCycle = p->finishTime;
+        wxMessageBox("No se pudo abrir el archivo de procesos.", "Error", wxOK | wxICON_ERROR);
     }
-
-    // 5) Actualizar métricas:
-    double sumaWT = 0.0;
-    double sumaTAT = 0.0;
-    int ultimoFin = 0;
-
-    for (const auto &p : m_processes)
+    else
     {
-        sumaWT += p.waitingTime;
-        sumaTAT += (p.finishTime - p.arrivalTime);
-        ultimoFin = std::max(ultimoFin, p.finishTime);
+        ShowLoadWarnings(warnings);
     }
 
-    double avgWT = sumaWT / m_processes.size();
-    double avgTAT = sumaTAT / m_processes.size();
-    double throughput = double(m_processes.size()) / double(ultimoFin);
-
-    m_metricsGrid->SetCellValue(0, 1, wxString::Format("%.2f", avgWT));
-    m_metricsGrid->SetCellValue(1, 1, wxString::Format("%.2f", avgTAT));
-    m_metricsGrid->SetCellValue(2, 1, wxString::Format("%.2f", throughput));
+    // La lista lee las filas directamente de m_workload
+    m_processListCtrl->SetRowCount(m_workload.Size());
 
-    // 6) Pasar estos procesos al Gantt y reiniciar el diagrama para que empiece a pintar desde cero
-    m_ganttChart->SetProcesses(m_processes);
-    m_ganttChart->ResetChart();
+    // Activar botón “Iniciar” si ya hay procesos y al menos un algoritmo está seleccionado
+    m_startBtn->Enable(!CheckedAlgorithms().empty() && !m_workload.Empty());
+    m_sweepBtn->Enable(!m_workload.Empty());
+    UpdateMetrics();
 }
 
-void SchedulingPanel::ScheduleSJF()
+std::vector<Algorithm> SchedulingPanel::CheckedAlgorithms() const
 {
-    // 1) Si no hay procesos cargados, salimos
-    if (m_processes.empty())
-        return;
+    std::vector<Algorithm> algs;
+    if (m_fifoCheck->GetValue())
+        algs.push_back(Algorithm::FIFO);
+    if (m_sjfCheck->GetValue())
+        algs.push_back(Algorithm::SJF);
+    if (m_srtCheck->GetValue())
+        algs.push_back(Algorithm::SRT);
+    if (m_rrCheck->GetValue())
+        algs.push_back(Algorithm::RR);
+    if (m_priorityCheck->GetValue())
+        algs.push_back(Algorithm::Priority);
+    if (m_mlfqCheck->GetValue())
+        algs.push_back(Algorithm::MLFQ);
+    if (m_cfsCheck->GetValue())
+        algs.push_back(Algorithm::CFS);
+    if (m_priorityPCheck->GetValue())
+        algs.push_back(Algorithm::PriorityP);
+    if (m_edfCheck->GetValue())
+        algs.push_back(Algorithm::EDF);
+    if (m_rmCheck->GetValue())
+        algs.push_back(Algorithm::RM);
+    return algs;
+}
 
-    // 2) Creamos un vector local "ordenados" con copia de todos los procesos
-    // y los ordenamos inicialmente por arrivalTime (para saber quién llega primero).
-    std::vector<Process> ordenados = m_processes;
-    std::sort(ordenados.begin(), ordenados.end(),
-              [](const Process &a, const Process &b)
-              {
-                  return a.arrivalTime < b.arrivalTime;
-              });
-
-    // 3) Preparar la "ready queue" donde iremos metiendo punteros a procesos ya llegados
-    std::vector<Process *> readyQueue;
-    int currentCycle = 0;
-    size_t idx = 0; // índice para ir introduciendo elementos de "ordenados"
-
-    // 4) Mientras queden procesos sin ejecutar (o listos en readyQueue)...
-    while (idx < ordenados.size() || !readyQueue.empty())
-    {
-        // 4a) Mover a readyQueue todos los procesos cuya arrivalTime <= currentCycle
-        while (idx < ordenados.size() && ordenados[idx].arrivalTime <= currentCycle)
+void SchedulingPanel::BuildLanes(std::vector<GanttLane> &lanes, std::vector<GanttSegment> &segments) const
+{
+    lanes.clear();
+    segments.clear();
+
+    // Varios CPUs: un carril por CPU (y por algoritmo si hay varios) con los
+    // segmentos de todos los procesos que corrieron en el ordenados por tiempo
+    bool smp = false;
+    for (const ScheduleResult &result : m_results)
+        smp = smp || result.cpus > 1;
+    if (smp)
+    {
+        for (size_t k = 0; k < m_results.size(); ++k)
         {
-            readyQueue.push_back(&ordenados[idx]);
-            idx++;
-        }
+            const ScheduleResult &result = m_results[k];
+            size_t primero = lanes.size();
+            for (int c = 0; c < result.cpus; ++c)
+            {
+                wxString titulo = wxString::Format("CPU %d", c);
+                if (m_results.size() > 1)
+                    titulo = wxString(AlgorithmName(m_resultAlgorithms[k])) + " " + titulo;
+                lanes.push_back({titulo, 0, 0});
+            }
 
-        // 4b) Si no hay procesos en readyQueue, avanzamos currentCycle al próximo arrivalTime
-        if (readyQueue.empty())
-        {
-            currentCycle = ordenados[idx].arrivalTime;
-            continue;
+            // Conteo por CPU y prefijos, como ResultBuilder con los procesos
+            // (los algoritmos sin variante SMP dejan todo en el CPU 0)
+            auto cpuDe = [&result](size_t s)
+            { return result.segmentCpu.empty() ? 0 : result.segmentCpu[s]; };
+            for (size_t s = 0; s < result.segments.size(); ++s)
+                lanes[primero + cpuDe(s)].count++;
+            size_t inicio = segments.size();
+            for (size_t c = primero; c < lanes.size(); ++c)
+            {
+                lanes[c].first = inicio;
+                inicio += lanes[c].count;
+            }
+            std::vector<size_t> siguiente(lanes.size() - primero);
+            for (size_t c = 0; c < siguiente.size(); ++c)
+                siguiente[c] = lanes[primero + c].first;
+            segments.resize(inicio);
+            for (size_t i = 0; i < m_workload.Size(); ++i)
+            {
+                for (size_t s = result.segmentOffset[i]; s < result.segmentOffset[i + 1]; ++s)
+                {
+                    const ExecSegment &seg = result.segments[s];
+                    segments[siguiente[cpuDe(s)]++] = {seg.start, seg.length, i};
+                }
+            }
+            for (size_t c = primero; c < lanes.size(); ++c)
+                std::sort(segments.begin() + lanes[c].first, segments.begin() + lanes[c].first + lanes[c].count,
+                          [](const GanttSegment &a, const GanttSegment &b)
+                          { return a.start < b.start; });
         }
-
-        // 4c) De la readyQueue, elegimos el que tenga el burstTime más pequeño
-        auto it = std::min_element(readyQueue.begin(), readyQueue.end(),
-                                   [](Process *a, Process *b)
-                                   {
-                                       return a->burstTime < b->burstTime;
-                                   });
-        Process *elegido = *it;
-        readyQueue.erase(it); // lo sacamos de la cola
-
-        // 4d) Calculamos startTime, finishTime y waitingTime del proceso "elegido"
-        int inicio = std::max(currentCycle, elegido->arrivalTime);
-        elegido->startTime = inicio;
-        elegido->finishTime = inicio + elegido->burstTime;
-        elegido->waitingTime = elegido->startTime - elegido->arrivalTime;
-
-        // 4e) Actualizamos el reloj al finishTime de este proceso
-        currentCycle = elegido->finishTime;
+        return;
     }
 
-    // 5) Copiar startTime/finishTime/waitingTime de "ordenados" a "m_processes" (coincidiendo por pid)
-    for (const auto &p_done : ordenados)
+    // Un solo algoritmo: una fila por proceso, como el diagrama clasico
+    if (m_results.size() == 1)
     {
-        for (auto &orig : m_processes)
+        const ScheduleResult &result = m_results.front();
+        segments.reserve(result.segments.size());
+        for (size_t i = 0; i < m_workload.Size(); ++i)
         {
-            if (orig.pid == p_done.pid)
-            {
-                orig.startTime = p_done.startTime;
-                orig.finishTime = p_done.finishTime;
-                orig.waitingTime = p_done.waitingTime;
-                break;
-            }
+            GanttLane lane = {SymbolLabel(m_symbols, m_workload.pid[i]), segments.size(), 0};
+            for (const ExecSegment *seg = result.SegmentsBegin(i); seg != result.SegmentsEnd(i); ++seg)
+                segments.push_back({seg->start, seg->length, i});
+            lane.count = segments.size() - lane.first;
+            lanes.push_back(lane);
         }
+        return;
     }
 
-    // 6) Calcular métricas de eficiencia (Avg Waiting Time, Avg Turnaround Time, Throughput)
-    double sumaWT = 0.0, sumaTAT = 0.0;
-    int ultimoFin = 0;
-    for (const auto &proc : m_processes)
+    // Varios algoritmos: un carril por algoritmo para compararlos lado a lado,
+    // con los segmentos de todos los procesos ordenados por tiempo
+    for (size_t k = 0; k < m_results.size(); ++k)
     {
-        sumaWT += proc.waitingTime;
-        sumaTAT += (proc.finishTime - proc.arrivalTime);
-        if (proc.finishTime > ultimoFin)
-            ultimoFin = proc.finishTime;
+        const ScheduleResult &result = m_results[k];
+        GanttLane lane = {AlgorithmName(m_resultAlgorithms[k]), segments.size(), 0};
+        for (size_t i = 0; i < m_workload.Size(); ++i)
+        {
+            for (const ExecSegment *seg = result.SegmentsBegin(i); seg != result.SegmentsEnd(i); ++seg)
+                segments.push_back({seg->start, seg->length, i});
+        }
+        lane.count = segments.size() - lane.first;
+        std::sort(segments.begin() + lane.first, segments.end(),
+                  [](const GanttSegment &a, const GanttSegment &b)
+                  { return a.start < b.start; });
+        lanes.push_back(lane);
     }
-    double avgWT = sumaWT / m_processes.size();
-    double avgTAT = sumaTAT / m_processes.size();
-    double throughput = double(m_processes.size()) / double(ultimoFin);
-
-    // 7) Actualizar la grilla de métricas
-    m_metricsGrid->SetCellValue(0, 1, wxString::Format("%.2f", avgWT));
-    m_metricsGrid->SetCellValue(1, 1, wxString::Format("%.2f", avgTAT));
-    m_metricsGrid->SetCellValue(2, 1, wxString::Format("%.2f", throughput));
-
-    // 8) Pasamos estos procesos (con start/finish/waiting actualizados) al Gantt y reiniciamos el chart
-    m_ganttChart->SetProcesses(m_processes);
-    m_ganttChart->ResetChart();
 }
 
-void SchedulingPanel::ScheduleSRT()
+void SchedulingPanel::UpdateMetrics()
 {
-    if (m_processes.empty())
+    // Una columna de valores por algoritmo ejecutado (al menos una)
+    int columnas = 1 + std::max<int>(1, static_cast<int>(m_results.size()));
+    int actuales = m_metricsGrid->GetNumberCols();
+    if (actuales < columnas)
+        m_metricsGrid->AppendCols(columnas - actuales);
+    else if (actuales > columnas)
+        m_metricsGrid->DeleteCols(columnas, actuales - columnas);
+
+    if (m_results.empty())
     {
-        wxMessageBox("No hay procesos cargados.", "Atención", wxICON_INFORMATION);
+        m_metricsGrid->SetColLabelValue(1, "Valor");
+        for (int row = 0; row < 8; ++row)
+            m_metricsGrid->SetCellValue(row, 1, "");
+        m_processListCtrl->SetRowCount(m_workload.Size());
         return;
     }
 
-    struct ExecState
-    {
-        Process *proc;
-        int remainingTime;
-    };
-
-    int n = m_processes.size();
-    // 1) Inicializar cada proceso
-    for (auto &p : m_processes)
-    {
-        p.startTime = -1;
-        p.finishTime = -1;
-        p.waitingTime = 0;
-        p.segments.clear();
-    }
-
-    // 2) Ordenar punteros a procesos por arrivalTime para insertar en readyQueue
-    std::vector<Process *> arrivals;
-    arrivals.reserve(n);
-    for (auto &p : m_processes)
+    for (size_t k = 0; k < m_results.size(); ++k)
     {
-        arrivals.push_back(&p);
-    }
-    std::sort(arrivals.begin(), arrivals.end(),
-              [](Process *a, Process *b)
-              {
-                  return a->arrivalTime < b->arrivalTime;
-              });
-
-    int idx = 0; // índice en ‘arrivals’
-    int completed = 0;
-    int currentCycle = 0;
-    std::vector<ExecState> readyQueue;
-    readyQueue.reserve(n);
-
-    // 3) Ciclo principal
-    while (completed < n)
-    {
-        // 3a) Agregar todos los procesos cuyo arrivalTime == currentCycle
-        while (idx < n && arrivals[idx]->arrivalTime == currentCycle)
+        int col = 1 + static_cast<int>(k);
+        const SchedMetrics &m = m_results[k].metrics;
+        m_metricsGrid->SetColLabelValue(col, AlgorithmName(m_resultAlgorithms[k]));
+        m_metricsGrid->SetCellValue(0, col, wxString::Format("%.2f", m.avgWaitingTime));
+        m_metricsGrid->SetCellValue(1, col, wxString::Format("%.2f", m.avgTurnaroundTime));
+        m_metricsGrid->SetCellValue(2, col, wxString::Format("%.2f", m.throughput));
+        m_metricsGrid->SetCellValue(3, col, wxString::Format("%d", m.maxWaitTime));
+        m_metricsGrid->SetCellValue(4, col, wxString::Format("%d", m.migrations));
+
+        // Deadlines: solo EDF y RM
+        const RealTimeStats &rt = m_results[k].realtime;
+        if (rt.Empty())
         {
-            readyQueue.push_back({arrivals[idx], arrivals[idx]->burstTime});
-            idx++;
-        }
-
-        // 3b) Seleccionar el proceso con menor remainingTime
-        if (!readyQueue.empty())
-        {
-            auto itMin = std::min_element(
-                readyQueue.begin(), readyQueue.end(),
-                [](const ExecState &a, const ExecState &b)
-                {
-                    return a.remainingTime < b.remainingTime;
-                });
-            ExecState &exec = *itMin;
-            Process *p = exec.proc;
-
-            // 3c) Registrar segmento en p->segments
-            if (p->segments.empty() ||
-                p->segments.back().first + p->segments.back().second != currentCycle)
-            {
-                p->segments.push_back({currentCycle, 1});
-            }
-            else
-            {
-                p->segments.back().second += 1;
-            }
-
-            // 3d) Reducir tiempo restante
-            exec.remainingTime--;
-            if (exec.remainingTime == 0)
-            {
-                p->finishTime = currentCycle + 1;
-                completed++;
-                readyQueue.erase(itMin);
-            }
+            for (int row = 5; row < 8; ++row)
+                m_metricsGrid->SetCellValue(row, col, "-");
+            continue;
         }
-
-        currentCycle++;
+        static const char *veredictos[] = {"garantizado", "sin garantia", "sobrecarga"};
+        m_metricsGrid->SetCellValue(5, col, wxString::Format("%d de %d", rt.totalMisses, rt.totalJobs));
+        m_metricsGrid->SetCellValue(6, col, wxString::Format("%d", rt.worstLateness));
+        m_metricsGrid->SetCellValue(7, col, wxString::Format("%.3f / %.3f (%s)", rt.utilization, rt.utilizationBound,
+                                                             veredictos[static_cast<int>(rt.Verdict())]));
     }
+    m_metricsGrid->AutoSizeColumns();
+    m_processListCtrl->SetRowCount(m_workload.Size()); // refrescar "Espera max."
+}
 
-    // 4) Calcular startTime y waitingTime
-    for (auto &p : m_processes)
+wxString SchedulingPanel::MaxWaitCell(long item) const
+{
+    // Una espera por algoritmo ejecutado, en el orden de las columnas de metricas
+    wxString texto;
+    for (const ScheduleResult &result : m_results)
     {
-        if (!p.segments.empty())
-        {
-            p.startTime = p.segments.front().first;
-            p.waitingTime = p.finishTime - p.arrivalTime - p.burstTime;
-        }
+        if (static_cast<size_t>(item) >= result.maxWaitTime.size())
+            return "";
+        if (!texto.empty())
+            texto += " / ";
+        texto += wxString::Format("%d", result.maxWaitTime[item]);
     }
+    return texto;
+}
 
-    // 5) Calcular métricas
-    double totalWT = 0.0, totalTAT = 0.0;
-    int ultimoFin = 0;
-    for (const auto &p : m_processes)
+// Implementaciones similares para SynchronizationPanel
+void SynchronizationPanel::OnLoadProcesses(wxCommandEvent &event)
+{
+    wxFileDialog dialog(this, "Seleccionar archivo de procesos", "", "",
+                        kWorkloadWildcard, wxFD_OPEN | wxFD_FILE_MUST_EXIST);
+    if (dialog.ShowModal() == wxID_OK)
     {
-        totalWT += p.waitingTime;
-        totalTAT += (p.finishTime - p.arrivalTime);
-        ultimoFin = std::max(ultimoFin, p.finishTime);
+        LoadProcessesFromFile(dialog.GetPath());
     }
-    double avgWT = totalWT / n;
-    double avgTAT = totalTAT / n;
-    double throughput = double(n) / double(ultimoFin);
-
-    m_metricsGrid->SetCellValue(0, 1, wxString::Format("%.2f", avgWT));
-    m_metricsGrid->SetCellValue(1, 1, wxString::Format("%.2f", avgTAT));
-    m_metricsGrid->SetCellValue(2, 1, wxString::Format("%.2f", throughput));
-
-    // 6) Enviar a Gantt y reiniciar
-    m_ganttChart->SetProcesses(m_processes);
-    m_ganttChart->ResetChart();
 }
 
-void SchedulingPanel::ScheduleRR()
+void SynchronizationPanel::OnLoadResources(wxCommandEvent &event)
 {
-    if (m_processes.empty())
-        return;
-
-    int quantum = m_quantumSpin->GetValue();
-    std::vector<Process> procesos = m_processes;
-    int n = procesos.size();
-
-    for (auto &p : procesos)
+    wxFileDialog dialog(this, "Seleccionar archivo de recursos", "", "",
+                        kWorkloadWildcard, wxFD_OPEN | wxFD_FILE_MUST_EXIST);
+    if (dialog.ShowModal() == wxID_OK)
     {
-        p.startTime = -1;
-        p.finishTime = -1;
-        p.waitingTime = 0;
-        p.segments.clear();
+        LoadResourcesFromFile(dialog.GetPath());
     }
+}
 
-    std::queue<Process *> readyQueue;
-    int currentCycle = 0;
-    int completed = 0;
-
-    std::vector<int> remainingBT(n);
-    for (int i = 0; i < n; ++i)
+void SynchronizationPanel::OnLoadActions(wxCommandEvent &event)
+{
+    wxFileDialog dialog(this, "Seleccionar archivo de acciones", "", "",
+                        kWorkloadWildcard, wxFD_OPEN | wxFD_FILE_MUST_EXIST);
+    if (dialog.ShowModal() == wxID_OK)
     {
-        remainingBT[i] = procesos[i].burstTime;
+        LoadActionsFromFile(dialog.GetPath());
     }
+}
 
-    std::vector<bool> inQueue(n, false);
+void SynchronizationPanel::OnStartSimulation(wxCommandEvent &event)
+{
+    m_timelineChart->StartSimulation();
+    m_startBtn->Enable(false);
+    m_stopBtn->Enable(true);
+}
 
-    while (completed < n)
-    {
-        // Agregar procesos que llegan este ciclo
-        for (int i = 0; i < n; ++i)
-        {
-            if (procesos[i].arrivalTime == currentCycle && !inQueue[i])
-            {
-                readyQueue.push(&procesos[i]);
-                inQueue[i] = true;
-            }
-        }
-
-        if (readyQueue.empty())
-        {
-            currentCycle++;
-            continue;
-        }
-
-        Process *p = readyQueue.front();
-        readyQueue.pop();
-
-        int index = std::distance(procesos.begin(), std::find_if(procesos.begin(), procesos.end(),
-                                                                 [&](const Process &proc)
-                                                                 { return proc.pid == p->pid; }));
-        int execTime = std::min(quantum, remainingBT[index]);
-
-        // Añadir segmento RR
-        p->segments.push_back({currentCycle, execTime});
-
-        remainingBT[index] -= execTime;
-        currentCycle += execTime;
-
-        // Añadir procesos que llegaron mientras este ejecutaba
-        for (int i = 0; i < n; ++i)
-        {
-            if (procesos[i].arrivalTime > currentCycle - execTime &&
-                procesos[i].arrivalTime <= currentCycle && !inQueue[i])
-            {
-                readyQueue.push(&procesos[i]);
-                inQueue[i] = true;
-            }
-        }
-
-        if (remainingBT[index] > 0)
-        {
-            readyQueue.push(p); // volver a encolar
-        }
-        else
-        {
-            p->finishTime = currentCycle;
-            completed++;
-        }
-    }
-
-    for (auto &p : procesos)
-    {
-        p.startTime = p.segments.front().first;
-        int execution = 0;
-        for (const auto &seg : p.segments)
-        {
-            execution += seg.second;
-        }
-        p.waitingTime = p.finishTime - p.arrivalTime - execution;
-    }
-
-    // Copiar a procesos reales
-    for (auto &p_new : procesos)
-    {
-        for (auto &p_old : m_processes)
-        {
-            if (p_new.pid == p_old.pid)
-            {
-                p_old.startTime = p_new.startTime;
-                p_old.finishTime = p_new.finishTime;
-                p_old.waitingTime = p_new.waitingTime;
-                p_old.segments = p_new.segments;
-            }
-        }
-    }
-
-    // Métricas
-    double totalWT = 0, totalTAT = 0;
-    int ultimoFin = 0;
-    for (const auto &p : m_processes)
-    {
-        totalWT += p.waitingTime;
-        totalTAT += (p.finishTime - p.arrivalTime);
-        ultimoFin = std::max(ultimoFin, p.finishTime);
-    }
-
-    m_metricsGrid->SetCellValue(0, 1, wxString::Format("%.2f", totalWT / n));
-    m_metricsGrid->SetCellValue(1, 1, wxString::Format("%.2f", totalTAT / n));
-    m_metricsGrid->SetCellValue(2, 1, wxString::Format("%.2f", double(n) / ultimoFin));
-
-    // Visualización
-    m_ganttChart->SetProcesses(m_processes);
-    m_ganttChart->ResetChart();
+void SynchronizationPanel::OnStopSimulation(wxCommandEvent &event)
+{
+    m_timelineChart->StopSimulation();
+    m_startBtn->Enable(true);
+    m_stopBtn->Enable(false);
 }
 
-void SchedulingPanel::SchedulePriority()
+void SynchronizationPanel::OnResetSimulation(wxCommandEvent &event)
 {
-    if (m_processes.empty())
-        return;
-
-    std::vector<Process> procesos = m_processes;
-    int n = procesos.size();
+    m_timelineChart->ResetChart();
+    m_startBtn->Enable(!m_processes.Empty() && !m_resources.empty() && !m_actions.empty());
+    m_stopBtn->Enable(false);
+}
 
-    for (auto &p : procesos)
+void SynchronizationPanel::OnSyncModeChange(wxCommandEvent &event)
+{
+    // Actualizar configuracion segun el modo de sincronizacion seleccionado
+    wxString mode = m_syncModeChoice->GetStringSelection();
+    ApplySyncOptions();
+    // Corregir acceso al StatusBar
+    MainFrame *mainFrame = dynamic_cast<MainFrame *>(GetParent()->GetParent());
+    if (mainFrame)
     {
-        p.startTime = -1;
-        p.finishTime = -1;
-        p.waitingTime = 0;
-        p.segments.clear();
+        mainFrame->SetStatusText("Modo: " + mode, 1);
     }
+}
 
-    std::vector<Process *> readyQueue;
-    int currentCycle = 0;
-    size_t idx = 0;
-
-    std::sort(procesos.begin(), procesos.end(), [](const Process &a, const Process &b)
-              { return a.arrivalTime < b.arrivalTime; });
-
-    while (idx < procesos.size() || !readyQueue.empty())
-    {
-        while (idx < procesos.size() && procesos[idx].arrivalTime <= currentCycle)
-        {
-            readyQueue.push_back(&procesos[idx]);
-            idx++;
-        }
-
-        if (readyQueue.empty())
-        {
-            currentCycle = procesos[idx].arrivalTime;
-            continue;
-        }
-
-        auto it = std::min_element(readyQueue.begin(), readyQueue.end(),
-                                   [](Process *a, Process *b)
-                                   {
-                                       return a->priority < b->priority;
-                                   });
-
-        Process *elegido = *it;
-        readyQueue.erase(it);
+void SynchronizationPanel::OnSyncOptionChange(wxCommandEvent &event)
+{
+    ApplySyncOptions();
+}
 
-        int inicio = std::max(currentCycle, elegido->arrivalTime);
-        elegido->startTime = inicio;
-        elegido->finishTime = inicio + elegido->burstTime;
-        elegido->waitingTime = elegido->startTime - elegido->arrivalTime;
-        elegido->segments.push_back({inicio, elegido->burstTime});
-        currentCycle = elegido->finishTime;
-    }
+void SynchronizationPanel::OnHoldChange(wxSpinEvent &event)
+{
+    ApplySyncOptions();
+}
 
-    for (const auto &p_src : procesos)
+void SynchronizationPanel::OnParallelismReport(wxCommandEvent &event)
+{
+    if (m_processes.Empty() || m_resources.empty() || m_actions.empty())
     {
-        for (auto &p_dst : m_processes)
-        {
-            if (p_dst.pid == p_src.pid)
-            {
-                p_dst.startTime = p_src.startTime;
-                p_dst.finishTime = p_src.finishTime;
-                p_dst.waitingTime = p_src.waitingTime;
-                p_dst.segments = p_src.segments;
-            }
-        }
+        wxMessageBox("Cargue procesos, recursos y acciones primero.", "Atención", wxICON_INFORMATION);
+        return;
     }
 
-    double totalWT = 0, totalTAT = 0;
-    int ultimoFin = 0;
-    for (const auto &p : m_processes)
+    // La corrida actual ya esta simulada; la referencia es la misma carga con
+    // un mutex, las mismas colas y la misma retencion
+    SyncOptions mutex = m_timelineChart->GetSyncOptions();
+    mutex.mode = SyncMode::Mutex;
+    SyncTimeline referencia;
     {
-        totalWT += p.waitingTime;
-        totalTAT += (p.finishTime - p.arrivalTime);
-        ultimoFin = std::max(ultimoFin, p.finishTime);
+        wxBusyCursor espera;
+        referencia = SimulateSync(m_processes, m_resources, m_actions, m_actionIndex, mutex);
     }
 
-    m_metricsGrid->SetCellValue(0, 1, wxString::Format("%.2f", totalWT / n));
-    m_metricsGrid->SetCellValue(1, 1, wxString::Format("%.2f", totalTAT / n));
-    m_metricsGrid->SetCellValue(2, 1, wxString::Format("%.2f", double(n) / ultimoFin));
-
-    m_ganttChart->SetProcesses(m_processes);
-    m_ganttChart->ResetChart();
+    ParallelismDialog dialog(this, m_syncModeChoice->GetStringSelection(), m_symbols, m_resources,
+                             m_timelineChart->GetTimeline(), referencia);
+    dialog.ShowModal();
 }
 
-void SchedulingPanel::UpdateMetrics()
+void SynchronizationPanel::OnMetricsViewChange(wxCommandEvent &event)
 {
-    // Calcular y mostrar metricas
-    m_metricsGrid->SetCellValue(0, 1, "5.2");
-    m_metricsGrid->SetCellValue(1, 1, "8.7");
-    m_metricsGrid->SetCellValue(2, 1, "0.8");
+    UpdateSyncMetrics();
 }
 
-// Implementaciones similares para SynchronizationPanel
-void SynchronizationPanel::OnLoadProcesses(wxCommandEvent &event)
+void SynchronizationPanel::OnExportMetrics(wxCommandEvent &event)
 {
-    wxFileDialog dialog(this, "Seleccionar archivo de procesos", "", "",
-                        "Archivos de texto (*.txt)|*.txt", wxFD_OPEN | wxFD_FILE_MUST_EXIST);
-    if (dialog.ShowModal() == wxID_OK)
+    if (m_processes.Empty() || m_resources.empty() || m_actions.empty())
     {
-        LoadProcessesFromFile(dialog.GetPath());
+        wxMessageBox("Cargue procesos, recursos y acciones primero.", "Atención", wxICON_INFORMATION);
+        return;
     }
-}
 
-void SynchronizationPanel::OnLoadResources(wxCommandEvent &event)
-{
-    wxFileDialog dialog(this, "Seleccionar archivo de recursos", "", "",
-                        "Archivos de texto (*.txt)|*.txt", wxFD_OPEN | wxFD_FILE_MUST_EXIST);
-    if (dialog.ShowModal() == wxID_OK)
+    wxFileDialog dialog(this, "Exportar metricas de sincronizacion", "", "metricas_sincronizacion.csv",
+                        "Archivos CSV (*.csv)|*.csv", wxFD_SAVE | wxFD_OVERWRITE_PROMPT);
+    if (dialog.ShowModal() != wxID_OK)
+        return;
+
+    if (!SaveSyncMetrics(dialog.GetPath().ToStdString(), m_symbols, m_processes, m_resources,
+                         m_timelineChart->GetTimeline()))
     {
-        LoadResourcesFromFile(dialog.GetPath());
+        wxMessageBox("No se pudo escribir el archivo de metricas.", "Error", wxOK | wxICON_ERROR);
     }
 }
 
-void SynchronizationPanel::OnLoadActions(wxCommandEvent &event)
+void SynchronizationPanel::UpdateSyncMetrics()
 {
-    wxFileDialog dialog(this, "Seleccionar archivo de acciones", "", "",
-                        "Archivos de texto (*.txt)|*.txt", wxFD_OPEN | wxFD_FILE_MUST_EXIST);
-    if (dialog.ShowModal() == wxID_OK)
+    // Filas de la tabla: los recursos o procesos con mas ciclos de espera
+    const int kMaxMetricRows = 100;
+    const SyncTimeline &t = m_timelineChart->GetTimeline();
+    const bool porProceso = m_metricsViewChoice->GetSelection() == 1;
+
+    // 1. Candidatos sin repetir: IDs de recurso o la primera fila de cada PID
+    std::vector<int> filas;
+    std::vector<char> visto(m_symbols.Size(), 0);
+    if (porProceso)
     {
-        LoadActionsFromFile(dialog.GetPath());
+        for (size_t i = 0; i < t.processes.size(); ++i)
+        {
+            if (!visto[m_processes.pid[i]])
+                filas.push_back(static_cast<int>(i));
+            visto[m_processes.pid[i]] = 1;
+        }
+    }
+    else
+    {
+        for (const auto &r : m_resources)
+        {
+            if (static_cast<size_t>(r.name) < t.resources.size() && !visto[r.name])
+                filas.push_back(r.name);
+            visto[r.name] = 1;
+        }
     }
-}
-
-void SynchronizationPanel::OnStartSimulation(wxCommandEvent &event)
-{
-    m_timelineChart->StartSimulation();
-    m_startBtn->Enable(false);
-    m_stopBtn->Enable(true);
-}
-
-void SynchronizationPanel::OnStopSimulation(wxCommandEvent &event)
-{
-    m_timelineChart->StopSimulation();
-    m_startBtn->Enable(true);
-    m_stopBtn->Enable(false);
-}
 
-void SynchronizationPanel::OnResetSimulation(wxCommandEvent &event)
-{
-    m_timelineChart->ResetChart();
-    m_startBtn->Enable(!m_processes.empty() && !m_resources.empty() && !m_actions.empty());
-    m_stopBtn->Enable(false);
+    // 2. Los de mayor espera primero
+    auto espera = [&](int k)
+    { return porProceso ? t.processes[k].blockedCycles : t.resources[k].waitCycles; };
+    size_t mostrar = std::min(filas.size(), static_cast<size_t>(kMaxMetricRows));
+    std::partial_sort(filas.begin(), filas.begin() + mostrar, filas.end(), [&](int a, int b)
+                      { return espera(a) != espera(b) ? espera(a) > espera(b) : a < b; });
+
+    // 3. Ajustar la tabla y llenarla
+    m_syncMetricsGrid->BeginBatch();
+    int actuales = m_syncMetricsGrid->GetNumberRows();
+    if (actuales > 0)
+        m_syncMetricsGrid->DeleteRows(0, actuales);
+    m_syncMetricsGrid->AppendRows(static_cast<int>(mostrar));
+
+    const wxString recursos[] = {"Recurso", "Utilizacion", "Paralelismo", "Espera Prom.",
+                                 "Espera p99", "Esperas", "Sin Acceso", "Cola Max."};
+    const wxString procesos[] = {"PID", "Accesos", "Esperas", "Sin Acceso",
+                                 "Ciclos Bloqueado", "Espera Max.", "Recurso Principal", "Espera en Principal"};
+    for (int col = 0; col < 8; ++col)
+        m_syncMetricsGrid->SetColLabelValue(col, porProceso ? procesos[col] : recursos[col]);
+
+    for (size_t k = 0; k < mostrar; ++k)
+    {
+        int row = static_cast<int>(k);
+        if (porProceso)
+        {
+            const SyncProcessStats &p = t.processes[filas[k]];
+            m_syncMetricsGrid->SetCellValue(row, 0, SymbolLabel(m_symbols, m_processes.pid[filas[k]]));
+            m_syncMetricsGrid->SetCellValue(row, 1, wxString::Format("%d", p.accesses));
+            m_syncMetricsGrid->SetCellValue(row, 2, wxString::Format("%d", p.waits));
+            m_syncMetricsGrid->SetCellValue(row, 3, wxString::Format("%d", p.starved));
+            m_syncMetricsGrid->SetCellValue(row, 4, wxString::Format("%lld", p.blockedCycles));
+            m_syncMetricsGrid->SetCellValue(row, 5, wxString::Format("%d", p.maxWait));
+            m_syncMetricsGrid->SetCellValue(row, 6, p.worstResource >= 0 ? SymbolLabel(m_symbols, p.worstResource) : wxString("-"));
+            m_syncMetricsGrid->SetCellValue(row, 7, wxString::Format("%lld", p.worstResourceCycles));
+        }
+        else
+        {
+            const SyncResourceStats &r = t.resources[filas[k]];
+            m_syncMetricsGrid->SetCellValue(row, 0, SymbolLabel(m_symbols, filas[k]));
+            m_syncMetricsGrid->SetCellValue(row, 1, wxString::Format("%.1f%%", 100.0 * r.Utilization(t.finishCycle)));
+            m_syncMetricsGrid->SetCellValue(row, 2, wxString::Format("%.2f", r.Parallelism()));
+            m_syncMetricsGrid->SetCellValue(row, 3, wxString::Format("%.2f", r.AvgWait()));
+            m_syncMetricsGrid->SetCellValue(row, 4, wxString::Format("%d", r.p99Wait));
+            m_syncMetricsGrid->SetCellValue(row, 5, wxString::Format("%d", r.waits));
+            m_syncMetricsGrid->SetCellValue(row, 6, wxString::Format("%d", r.starved));
+            m_syncMetricsGrid->SetCellValue(row, 7, wxString::Format("%d", r.maxQueue));
+        }
+    }
+    m_syncMetricsGrid->AutoSizeColumns();
+    m_syncMetricsGrid->EndBatch();
 }
 
-void SynchronizationPanel::OnSyncModeChange(wxCommandEvent &event)
+void SynchronizationPanel::ApplySyncOptions()
 {
-    // Actualizar configuracion segun el modo de sincronizacion seleccionado
-    wxString mode = m_syncModeChoice->GetStringSelection();
-    // Corregir acceso al StatusBar
-    MainFrame *mainFrame = dynamic_cast<MainFrame *>(GetParent()->GetParent());
-    if (mainFrame)
-    {
-        mainFrame->SetStatusText("Modo: " + mode, 1);
-    }
+    const SyncMode modos[] = {SyncMode::Mutex, SyncMode::Semaphore, SyncMode::ReaderWriter};
+    const SyncRwPolicy politicas[] = {SyncRwPolicy::ReaderPreferring, SyncRwPolicy::WriterPreferring,
+                                      SyncRwPolicy::Fair};
+    SyncOptions options;
+    options.mode = modos[std::max(0, m_syncModeChoice->GetSelection())];
+    options.wakeOrder = m_wakeOrderChoice->GetSelection() == 1 ? SyncWakeOrder::Priority : SyncWakeOrder::Fifo;
+    options.holdCycles = m_holdSpin->GetValue();
+    options.rwPolicy = politicas[std::max(0, m_rwPolicyChoice->GetSelection())];
+    options.holdWhileBlocked = m_holdBlockedCheck->GetValue();
+    m_rwPolicyChoice->Enable(options.mode == SyncMode::ReaderWriter);
+    m_timelineChart->SetSyncOptions(options);
 }
 
 void SynchronizationPanel::LoadProcessesFromFile(const wxString &filename)
 {
-    // Limpiar la lista anterior y el vector m_processes
-    m_processListCtrl->DeleteAllItems();
-    m_processes.clear();
+    // Vaciar la lista y el timeline antes de que el cargador vacie m_processes
+    m_processListCtrl->SetRowCount(0);
+    m_timelineChart->ClearData();
 
-    std::ifstream file(filename.ToStdString());
-    if (!file.is_open())
+    std::vector<std::string> warnings;
+    if (!LoadProcessFile(filename.ToStdString(), m_symbols, m_processes, warnings))
     {
         wxMessageBox("No se pudo abrir el archivo de procesos.", "Error", wxOK | wxICON_ERROR);
         return;
     }
+    ShowLoadWarnings(warnings);
 
-    std::string line;
-    // Paleta de colores pastel para filas alternadas y texto
-    std::vector<wxColour> pastelBackgrounds = {
-        wxColour(255, 230, 230), // rosa suave
-        wxColour(230, 230, 255), // azul suave
-        wxColour(230, 255, 230), // verde suave
-        wxColour(230, 255, 255), // cian suave
-        wxColour(255, 255, 230), // amarillo suave
-        wxColour(255, 230, 255)  // magenta suave
-    };
-    std::vector<wxColour> textColours = {
-        wxColour(150, 0, 0),   // rojo oscuro
-        wxColour(0, 0, 150),   // azul oscuro
-        wxColour(0, 150, 0),   // verde oscuro
-        wxColour(0, 150, 150), // cian oscuro
-        wxColour(150, 150, 0), // amarillo oscuro
-        wxColour(150, 0, 150)  // magenta oscuro
-    };
-
-    int colorIndex = 0;
-    while (std::getline(file, line))
-    {
-        if (line.empty())
-            continue;
-
-        try
-        {
-            std::stringstream ss(line);
-            std::string pid_str, bt_str, at_str, prio_str;
-
-            // Leer cada campo hasta la coma
-            std::getline(ss, pid_str, ',');
-            std::getline(ss, bt_str, ',');
-            std::getline(ss, at_str, ',');
-            std::getline(ss, prio_str, ',');
-
-            // Función corta para eliminar espacios al inicio y fin
-            auto trim = [&](std::string &s)
-            {
-                s.erase(0, s.find_first_not_of(" \t\r\n"));
-                s.erase(s.find_last_not_of(" \t\r\n") + 1);
-            };
-            trim(pid_str);
-            trim(bt_str);
-            trim(at_str);
-            trim(prio_str);
-
-            int bt = std::stoi(bt_str);
-            int at = std::stoi(at_str);
-            int prio = std::stoi(prio_str);
-
-            // Asignar colores según índice (ciclo)
-            wxColour bg = pastelBackgrounds[colorIndex % pastelBackgrounds.size()];
-            wxColour fg = textColours[colorIndex % textColours.size()];
-            colorIndex++;
-
-            Process p;
-            p.pid = wxString(pid_str);
-            p.burstTime = bt;
-            p.arrivalTime = at;
-            p.priority = prio;
-            p.color = fg; // color de texto en la vista
-            p.startTime = 0;
-            p.finishTime = 0;
-            p.waitingTime = 0;
-            m_processes.push_back(p);
-
-            // Insertar fila en el ListCtrl
-            long idx = m_processListCtrl->InsertItem(
-                m_processListCtrl->GetItemCount(),
-                p.pid);
-            m_processListCtrl->SetItem(idx, 1, wxString::Format("%d", p.burstTime));
-            m_processListCtrl->SetItem(idx, 2, wxString::Format("%d", p.arrivalTime));
-            m_processListCtrl->SetItem(idx, 3, wxString::Format("%d", p.priority));
-
-            // Aplicar estilos: fondo pastel y texto oscuro
-            m_processListCtrl->SetItemBackgroundColour(idx, bg);
-            m_processListCtrl->SetItemTextColour(idx, fg);
-
-            // Fuente en negrita para PID
-            wxFont boldFont = m_processListCtrl->GetFont();
-            boldFont.SetWeight(wxFONTWEIGHT_BOLD);
-            m_processListCtrl->SetItemFont(idx, boldFont);
-        }
-        catch (const std::invalid_argument &)
-        {
-            wxMessageBox("Formato inválido en línea: \"" + wxString(line) + "\". Se omite.",
-                         "Advertencia", wxOK | wxICON_WARNING);
-            continue;
-        }
-        catch (const std::out_of_range &)
-        {
-            wxMessageBox("Valor fuera de rango en línea: \"" + wxString(line) + "\". Se omite.",
-                         "Advertencia", wxOK | wxICON_WARNING);
-            continue;
-        }
-        catch (...)
-        {
-            wxMessageBox("Error desconocido al procesar línea: \"" + wxString(line) + "\". Se omite.",
-                         "Advertencia", wxOK | wxICON_WARNING);
-            continue;
-        }
-    }
+    // Las filas se leen de m_processes al mostrarse, con el estilo de m_processAttrs
+    m_processListCtrl->SetRowCount(m_processes.Size());
+    m_timelineChart->SetData(&m_processes, &m_resources, &m_actions, &m_actionIndex, &m_symbols);
 
     // Ajustar automáticamente ancho de columnas
     for (int col = 0; col < 4; ++col)
@@ -1443,52 +1651,20 @@ void SynchronizationPanel::LoadProcessesFromFile(const wxString &filename)
 void SynchronizationPanel::LoadResourcesFromFile(const wxString &filename)
 {
     // Limpiar la lista y el vector de recursos anteriores
-    m_resourceListCtrl->DeleteAllItems();
-    m_resources.clear();
+    m_resourceListCtrl->SetRowCount(0);
+    m_timelineChart->ClearData();
 
-    std::ifstream file(filename.ToStdString());
-    if (!file.is_open())
+    std::vector<std::string> warnings;
+    if (!LoadResourceFile(filename.ToStdString(), m_symbols, m_resources, warnings))
     {
         wxMessageBox("No se pudo abrir el archivo de recursos.", "Error", wxOK | wxICON_ERROR);
         return;
     }
+    ShowLoadWarnings(warnings);
 
-    std::string line;
-    while (std::getline(file, line))
-    {
-        if (line.empty())
-            continue; // saltar líneas en blanco
-
-        std::stringstream ss(line);
-        std::string name_str, counter_str;
-
-        // Leer cada campo hasta la coma
-        std::getline(ss, name_str, ',');
-        std::getline(ss, counter_str, ',');
-
-        // Eliminar espacios al inicio y al final de cada string
-        auto trim = [&](std::string &s)
-        {
-            s.erase(0, s.find_first_not_of(" \t\r\n")); // trim left
-            s.erase(s.find_last_not_of(" \t\r\n") + 1); // trim right
-        };
-        trim(name_str);
-        trim(counter_str);
-
-        // Convertir counter a entero seguro
-        int counter = std::stoi(counter_str);
-
-        Resource r = {wxString(name_str), counter};
-        m_resources.push_back(r);
-    }
-
-    // Llenar el wxListCtrl con los recursos cargados
-    for (size_t i = 0; i < m_resources.size(); ++i)
-    {
-        long idx = m_resourceListCtrl->InsertItem(i, m_resources[i].name);
-        m_resourceListCtrl->SetItem(idx, 1,
-                                    wxString::Format("%d", m_resources[i].counter));
-    }
+    // La lista lee los recursos directamente de m_resources
+    m_resourceListCtrl->SetRowCount(m_resources.size());
+    m_timelineChart->SetData(&m_processes, &m_resources, &m_actions, &m_actionIndex, &m_symbols);
 
     // Verificar si ya se pueden habilitar los botones de “Iniciar Simulación”
     CheckEnableStart();
@@ -1496,56 +1672,32 @@ void SynchronizationPanel::LoadResourcesFromFile(const wxString &filename)
 
 void SynchronizationPanel::LoadActionsFromFile(const wxString &filename)
 {
-    // Implementar carga de acciones desde archivo
     // Formato: <PID>, <ACCION>, <RECURSO>, <CICLO>
-    m_actionListCtrl->DeleteAllItems();
-    m_actions.clear();
+    m_actionListCtrl->SetRowCount(0);
+    m_timelineChart->ClearData();
 
-    std::ifstream file(filename.ToStdString());
-    std::string line;
-
-    while (std::getline(file, line))
+    std::vector<std::string> warnings;
+    m_actionIndex.Clear();
+    if (!LoadActionFile(filename.ToStdString(), m_symbols, m_actions, warnings))
     {
-        std::stringstream ss(line);
-        std::string pid, accion, recurso;
-        int ciclo;
-        char coma;
-
-        std::getline(ss, pid, ',');
-        std::getline(ss, accion, ',');
-        std::getline(ss, recurso, ',');
-        ss >> ciclo;
-
-        // Limpiar espacios
-        pid.erase(0, pid.find_first_not_of(" \t\r\n"));
-        pid.erase(pid.find_last_not_of(" \t\r\n") + 1);
-        accion.erase(0, accion.find_first_not_of(" \t\r\n"));
-        accion.erase(accion.find_last_not_of(" \t\r\n") + 1);
-        recurso.erase(0, recurso.find_first_not_of(" \t\r\n"));
-        recurso.erase(recurso.find_last_not_of(" \t\r\n") + 1);
-
-        Action a = {wxString(pid), wxString(accion), wxString(recurso), ciclo};
-        m_actions.push_back(a);
+        wxMessageBox("No se pudo abrir el archivo de acciones.", "Error", wxOK | wxICON_ERROR);
+        return;
     }
+    ShowLoadWarnings(warnings);
 
-    // Actualizar lista visual
-    for (size_t i = 0; i < m_actions.size(); ++i)
-    {
-        long index = m_actionListCtrl->InsertItem(i, m_actions[i].pid);
-        m_actionListCtrl->SetItem(index, 1, m_actions[i].action);
-        m_actionListCtrl->SetItem(index, 2, m_actions[i].resource);
-        m_actionListCtrl->SetItem(index, 3, wxString::Format("%d", m_actions[i].cycle));
-    }
+    // Actualizar lista visual (lee de m_actions) y el indice por ciclo
+    m_actionListCtrl->SetRowCount(m_actions.size());
+    m_actionIndex.Build(m_actions);
 
     CheckEnableStart();
 
     // Actualizar datos en el timeline
-    m_timelineChart->SetData(m_processes, m_resources, m_actions);
+    m_timelineChart->SetData(&m_processes, &m_resources, &m_actions, &m_actionIndex, &m_symbols);
 }
 
 void SynchronizationPanel::CheckEnableStart()
 {
-    bool canStart = !m_processes.empty() && !m_resources.empty() && !m_actions.empty();
+    bool canStart = !m_processes.Empty() && !m_resources.empty() && !m_actions.empty();
     m_startBtn->Enable(canStart);
 }
 
@@ -1553,126 +1705,326 @@ void SynchronizationPanel::CheckEnableStart()
 void GanttChart::OnPaint(wxPaintEvent &event)
 {
     wxPaintDC dc(this);
-    DoPrepareDC(dc);
 
+    int ancho, alto;
+    GetClientSize(&ancho, &alto);
+    if (ancho <= 0 || alto <= 0)
+        return;
+
+    // 1. Origen de la vista en coordenadas logicas (con el scroll aplicado)
+    wxPoint origen;
+    CalcUnscrolledPosition(0, 0, &origen.x, &origen.y);
+
+    // 2. Si cambio el tamano o el scroll, el buffer se redibuja completo; si
+    //    no, solo la zona danada (la columna del ciclo que avanzo)
+    if (!m_backBuffer.IsOk() || m_backBuffer.GetWidth() != ancho || m_backBuffer.GetHeight() != alto)
+    {
+        m_backBuffer.Create(ancho, alto);
+        m_bufferValid = false;
+    }
+    wxRect danado = GetUpdateRegion().GetBox();
+    if (!m_bufferValid || origen.x != m_bufferOrigin.x || origen.y != m_bufferOrigin.y)
+    {
+        danado = wxRect(0, 0, ancho, alto);
+        m_bufferOrigin = origen;
+        m_bufferValid = true;
+    }
+
+    // 3. Dibujar en el buffer usando coordenadas logicas
+    wxMemoryDC mdc(m_backBuffer);
+    mdc.SetDeviceOrigin(-origen.x, -origen.y);
+    wxRect visible(danado.x + origen.x, danado.y + origen.y, danado.width, danado.height);
+    mdc.SetClippingRegion(visible);
+    DrawChart(mdc, visible);
+    mdc.DestroyClippingRegion();
+
+    // 4. Copiar a la ventana solo lo que se redibujo
+    dc.Blit(danado.x, danado.y, danado.width, danado.height, &mdc, visible.x, visible.y);
+}
+
+void GanttChart::DrawChart(wxDC &dc, const wxRect &visible)
+{
     // Limpiar fondo
-    dc.SetBackground(*wxWHITE_BRUSH);
-    dc.Clear();
+    dc.SetBrush(*wxWHITE_BRUSH);
+    dc.SetPen(*wxTRANSPARENT_PEN);
+    dc.DrawRectangle(visible);
 
-    if (m_processes.empty())
+    if (!m_workload || m_workload->Empty())
     {
+        dc.SetTextForeground(*wxBLACK);
         dc.DrawText("No hay procesos cargados", 10, 10);
         return;
     }
 
-    DrawTimeAxis(dc);
-    DrawProcessBlocks(dc);
+    DrawTimeAxis(dc, visible);
+    DrawProcessBlocks(dc, visible);
 
     // Mostrar ciclo actual
     dc.SetTextForeground(*wxBLACK);
     dc.DrawText(wxString::Format("Ciclo actual: %d", m_currentCycle), 10, 10);
 }
 
-void GanttChart::DrawTimeAxis(wxPaintDC &dc)
+// Paso entre marcas del eje: 1, 2 o 5 por una potencia de 10, el menor que
+// deja al menos 'minCycles' ciclos entre marcas
+static long long TickStep(double minCycles)
 {
-    dc.SetPen(*wxBLACK_PEN);
-    int baseY = 60;
-    dc.DrawLine(50, baseY, 960, baseY);
+    long long base = 1;
+    while (true)
+    {
+        for (long long factor : {1, 2, 5})
+            if (base * factor >= minCycles)
+                return base * factor;
+        base *= 10;
+    }
+}
 
-    for (int i = 0; i <= 30; ++i)
+void GanttChart::DrawTimeAxis(wxDC &dc, const wxRect &visible)
+{
+    dc.SetPen(*wxBLACK_PEN);
+    dc.SetTextForeground(*wxBLACK);
+    const int baseY = 60;
+    const int ultimo = std::max(m_lastCycle, 30); // sin resultados se ve el eje 0..30
+    dc.DrawLine(kMarginX, baseY, CycleX(ultimo) + 10, baseY);
+
+    // 1. Separacion minima: 30px o la etiqueta mas ancha con algo de aire
+    wxCoord anchoTexto, altoTexto;
+    dc.GetTextExtent(wxString::Format("%d", ultimo), &anchoTexto, &altoTexto);
+    long long paso = TickStep(std::max(30, anchoTexto + 10) / m_scale);
+
+    // 2. Solo las marcas visibles (desde una antes, por su etiqueta)
+    double cicloIni = (visible.GetLeft() - kMarginX) / m_scale;
+    long long primero = std::max(0LL, (static_cast<long long>(cicloIni) / paso - 1) * paso);
+    for (long long c = primero; c <= ultimo; c += paso)
     {
-        int x = 50 + i * 30; // 30px por ciclo
+        int x = CycleX(static_cast<double>(c));
+        if (x > visible.GetRight() + anchoTexto)
+            break;
+        wxString etiqueta = wxString::Format("%lld", c);
         dc.DrawLine(x, baseY - 5, x, baseY + 5);
-        dc.DrawText(wxString::Format("%d", i), x - 5, baseY + 10);
+        dc.DrawText(etiqueta, x - dc.GetTextExtent(etiqueta).GetWidth() / 2, baseY + 10);
     }
 }
 
-void GanttChart::DrawProcessBlocks(wxPaintDC &dc)
+void GanttChart::DrawProcessBlocks(wxDC &dc, const wxRect &visible)
 {
-    const int baseY = 80;       // Y de inicio
-    const int rowHeight = 30;   // Altura entre filas
-    const int blockHeight = 25; // Alto del bloque de proceso
-    const int pxPerCycle = 30;  // Escala horizontal
-    const int marginX = 50;     // Margen izquierdo
+    if (m_lanes.empty())
+        return;
+
+    // 1. Carriles que cruzan la zona visible
+    int filaIni = std::max(0, (visible.GetTop() - kBaseY) / kRowHeight);
+    int filaFin = std::max(0, (visible.GetBottom() - kBaseY) / kRowHeight + 1);
+    size_t primero = std::min(m_lanes.size(), static_cast<size_t>(filaIni));
+    size_t ultimo = std::min(m_lanes.size(), static_cast<size_t>(filaFin));
 
-    for (size_t i = 0; i < m_processes.size(); ++i)
+    // 2. Ciclos visibles; a la izquierda se deja margen para las etiquetas
+    //    que sobresalen de bloques cortos
+    double cicloIni = (visible.GetLeft() - kLabelSlack - kMarginX) / m_scale - 1;
+    double cicloFin = (visible.GetRight() + 1 - kMarginX) / m_scale + 1;
+
+    for (size_t i = primero; i < ultimo; ++i)
     {
-        const Process &proc = m_processes[i];
-        int y = baseY + static_cast<int>(i) * rowHeight;
+        const GanttLane &lane = m_lanes[i];
+        int y = kBaseY + static_cast<int>(i) * kRowHeight;
+
+        // Titulo del carril (PID o nombre del algoritmo)
+        dc.SetTextForeground(*wxBLACK);
+        dc.DrawText(lane.title, 5, y + 5);
 
-        // Si hay segmentos definidos (caso SRT, RR, FIFO adaptado...)
-        if (!proc.segments.empty())
+        // 3. Alejado, cada columna de pixeles cubre varios ciclos y se resume
+        if (m_scale < kSummaryPxPerCycle)
+            DrawLaneSummary(dc, i, y, visible);
+        else
+            DrawLaneSegments(dc, lane, y, cicloIni, cicloFin);
+    }
+}
+
+void GanttChart::DrawLaneSegments(wxDC &dc, const GanttLane &lane, int y, double firstCycle, double lastCycle)
+{
+    // Los segmentos de un carril no se solapan y estan ordenados por inicio,
+    // asi que tambien por fin: busqueda binaria del primero visible
+    const GanttSegment *seg = m_segments.data() + lane.first;
+    const GanttSegment *fin = seg + lane.count;
+    seg = std::partition_point(seg, fin, [firstCycle](const GanttSegment &s)
+                               { return s.start + s.length < firstCycle; });
+
+    for (; seg != fin && seg->start <= lastCycle; ++seg)
+    {
+        size_t color = seg->process % m_processBrushes.size();
+        int x = CycleX(seg->start);
+        int w = CycleX(static_cast<double>(seg->start) + seg->length) - x;
+
+        // Durante la animacion solo se colorea lo ejecutado hasta el ciclo actual
+        int anchoProgreso = w;
+        if (m_isRunning)
         {
-            for (const auto &seg : proc.segments)
-            {
-                int start = seg.first;
-                int length = seg.second;
-                int x = marginX + start * pxPerCycle;
-                int w = length * pxPerCycle;
-
-                dc.SetBrush(wxBrush(proc.color));
-                dc.SetPen(wxPen(proc.color.ChangeLightness(80), 2));
-                dc.DrawRectangle(x, y, w, blockHeight);
-
-                // Etiquetar PID dentro del bloque
-                dc.SetTextForeground(*wxWHITE);
-                dc.DrawText(proc.pid, x + 5, y + 5);
-            }
+            int progreso = std::max(0, std::min(seg->length, m_currentCycle - seg->start));
+            anchoProgreso = CycleX(static_cast<double>(seg->start) + progreso) - x;
+        }
+
+        if (anchoProgreso > 0)
+        {
+            dc.SetBrush(m_processBrushes[color]);
+            dc.SetPen(m_processPens[color]);
+            dc.DrawRectangle(x, y, anchoProgreso, kBlockHeight);
         }
-        // Si no hay segmentos, usar startTime y burstTime como antes (para compatibilidad)
-        else if (proc.burstTime > 0)
+        if (anchoProgreso < w)
         {
-            int x = marginX + proc.startTime * pxPerCycle;
-            int w = proc.burstTime * pxPerCycle;
+            dc.SetBrush(m_pendingBrush);
+            dc.SetPen(m_pendingPen);
+            dc.DrawRectangle(x + anchoProgreso, y, w - anchoProgreso, kBlockHeight);
+        }
 
-            if (m_isRunning && m_currentCycle >= proc.startTime)
-            {
-                int progreso = std::min(proc.burstTime, m_currentCycle - proc.startTime);
-                int anchoProgreso = progreso * pxPerCycle;
+        // Etiquetar PID dentro del bloque
+        if (w >= kMinLabelWidth)
+        {
+            dc.SetTextForeground(*wxWHITE);
+            dc.DrawText(SymbolLabel(*m_symbols, m_workload->pid[seg->process]), x + 5, y + 5);
+        }
+    }
+}
 
-                dc.SetBrush(wxBrush(proc.color));
-                dc.SetPen(wxPen(proc.color.ChangeLightness(80), 2));
-                dc.DrawRectangle(x, y, anchoProgreso, blockHeight);
+void GanttChart::DrawLaneSummary(wxDC &dc, size_t lane, int y, const wxRect &visible)
+{
+    // 1. Columnas de pixeles visibles y los ciclos que cubren
+    int xIni = std::max(visible.GetLeft(), kMarginX);
+    int xFin = visible.GetRight() + 1;
+    if (xFin <= xIni)
+        return;
+    const double ciclosPorColumna = 1 / m_scale;
+    const double cicloIni = (xIni - kMarginX) * ciclosPorColumna;
+    const double cicloFin = (xFin - kMarginX) * ciclosPorColumna;
+    std::vector<LodSummary> columnas(xFin - xIni);
+
+    // Reparte un tramo [inicio, fin) entre las columnas que toca, en
+    // proporcion a los ciclos de cada una
+    auto aportar = [&](double inicio, double fin, size_t proc, double ocupados, double delProceso)
+    {
+        double largo = fin - inicio;
+        long long c = std::max(0LL, static_cast<long long>((inicio - cicloIni) / ciclosPorColumna));
+        for (; c < static_cast<long long>(columnas.size()); ++c)
+        {
+            double desde = cicloIni + c * ciclosPorColumna;
+            if (desde >= fin)
+                break;
+            double parte = (std::min(fin, desde + ciclosPorColumna) - std::max(inicio, desde)) / largo;
+            if (parte > 0)
+                columnas[c].Add(proc, ocupados * parte, delProceso * parte);
+        }
+    };
 
-                if (anchoProgreso < w)
-                {
-                    dc.SetBrush(wxBrush(wxColour(200, 200, 200)));
-                    dc.SetPen(wxPen(*wxLIGHT_GREY, 1));
-                    dc.DrawRectangle(x + anchoProgreso, y, w - anchoProgreso, blockHeight);
-                }
-            }
-            else
-            {
-                dc.SetBrush(wxBrush(proc.color));
-                dc.SetPen(wxPen(proc.color.ChangeLightness(80), 2));
-                dc.DrawRectangle(x, y, w, blockHeight);
-            }
+    // 2. Fuente: el nivel mas grueso del indice cuyos bloques caben en una
+    //    columna; si ni el primero cabe, los segmentos del carril
+    int nivel = m_lodIndex.LevelFor(ciclosPorColumna);
+    if (nivel < 0)
+    {
+        const GanttLane &l = m_lanes[lane];
+        const GanttSegment *seg = m_segments.data() + l.first;
+        const GanttSegment *fin = seg + l.count;
+        seg = std::partition_point(seg, fin, [cicloIni](const GanttSegment &s)
+                                   { return s.start + s.length <= cicloIni; });
+        for (; seg != fin && seg->start < cicloFin; ++seg)
+            if (seg->length > 0)
+                aportar(seg->start, static_cast<double>(seg->start) + seg->length, seg->process,
+                        seg->length, seg->length);
+    }
+    else
+    {
+        const int shift = GanttLodIndex::Shift(nivel);
+        const long long tam = 1LL << shift;
+        const LodBucket *b = std::partition_point(m_lodIndex.Begin(nivel, lane), m_lodIndex.End(nivel, lane),
+                                                  [&](const LodBucket &k)
+                                                  { return (k.bucket + 1LL) * tam <= cicloIni; });
+        for (const LodBucket *fin = m_lodIndex.End(nivel, lane); b != fin && b->bucket * tam < cicloFin; ++b)
+            aportar(static_cast<double>(b->bucket * tam), static_cast<double>((b->bucket + 1LL) * tam),
+                    b->process, b->busy, b->processBusy);
+    }
 
-            dc.SetTextForeground(*wxWHITE);
-            dc.DrawText(proc.pid, x + 5, y + 5);
+    // 3. Dibujar las columnas; las vecinas iguales se unen en un rectangulo
+    auto estilo = [&](size_t k, const wxBrush *&brocha, int &alto)
+    {
+        const LodSummary &s = columnas[k];
+        brocha = nullptr;
+        alto = 0;
+        if (s.busy <= 0)
+            return;
+        bool pendiente = m_isRunning && cicloIni + k * ciclosPorColumna >= m_currentCycle;
+        brocha = pendiente ? &m_pendingBrush : &m_processBrushes[s.process % m_processBrushes.size()];
+        alto = kBlockHeight;
+        if (m_summary == GanttSummary::Occupancy)
+            alto = std::max(1, static_cast<int>(kBlockHeight * std::min(1.0, s.busy / ciclosPorColumna) + 0.5));
+    };
+
+    dc.SetPen(*wxTRANSPARENT_PEN);
+    size_t c = 0;
+    while (c < columnas.size())
+    {
+        const wxBrush *brocha;
+        int alto;
+        estilo(c, brocha, alto);
+        size_t siguiente = c + 1;
+        while (siguiente < columnas.size())
+        {
+            const wxBrush *otra;
+            int otroAlto;
+            estilo(siguiente, otra, otroAlto);
+            if (otra != brocha || otroAlto != alto)
+                break;
+            ++siguiente;
+        }
+        if (brocha)
+        {
+            dc.SetBrush(*brocha);
+            dc.DrawRectangle(xIni + static_cast<int>(c), y + kBlockHeight - alto,
+                             static_cast<int>(siguiente - c), alto);
         }
+        c = siguiente;
     }
 }
 
+int GanttChart::CycleX(double cycle) const
+{
+    double x = kMarginX + cycle * m_scale;
+    return static_cast<int>(std::min<double>(std::max(x, -1.0e9), 1.0e9));
+}
+
+void GanttChart::RefreshLogicalRect(const wxRect &rect)
+{
+    wxRect dispositivo(rect);
+    CalcScrolledPosition(rect.x, rect.y, &dispositivo.x, &dispositivo.y);
+    RefreshRect(dispositivo, false);
+}
+
+void GanttChart::InvalidateChart()
+{
+    m_bufferValid = false;
+    Refresh(false);
+}
+
 void GanttChart::OnTimer(wxTimerEvent &event)
 {
     if (m_isRunning)
     {
         m_currentCycle++;
 
-        // Actualizar scroll automaticamente
+        // Actualizar scroll automaticamente (Scroll redibuja la vista nueva)
         int x, y;
         GetViewStart(&x, &y);
-        if (m_currentCycle * 30 > GetSize().GetWidth() + x * 20)
+        if (CycleX(m_currentCycle) - kMarginX > GetSize().GetWidth() + x * kScrollUnit)
         {
             Scroll(x + 5, y);
         }
 
-        Refresh();
+        // Solo cambian la columna del ciclo que se acaba de ejecutar (mas el
+        // borde de 2px de los bloques) y el rotulo del ciclo actual
+        int alto = static_cast<int>(m_lanes.size()) * kRowHeight;
+        int desde = CycleX(m_currentCycle - 1);
+        int hasta = std::max(desde + 1, CycleX(m_currentCycle));
+        RefreshLogicalRect(wxRect(desde - 2, kBaseY - 2, hasta - desde + 4, alto + 4));
+        RefreshLogicalRect(wxRect(0, 0, 250, 30));
 
         // Detener cuando todos los procesos hayan terminado
-        if (m_currentCycle > 50)
-        { // Condicion de ejemplo
+        if (m_currentCycle >= m_lastCycle)
+        {
             StopSimulation();
         }
     }
@@ -1681,6 +2033,7 @@ void GanttChart::OnTimer(wxTimerEvent &event)
 void GanttChart::StartSimulation()
 {
     m_isRunning = true;
+    InvalidateChart();   // lo pendiente pasa a gris
     m_timer->Start(500); // 500ms por ciclo
 }
 
@@ -1688,6 +2041,7 @@ void GanttChart::StopSimulation()
 {
     m_isRunning = false;
     m_timer->Stop();
+    InvalidateChart();
 }
 
 void GanttChart::ResetChart()
@@ -1696,13 +2050,298 @@ void GanttChart::ResetChart()
     m_isRunning = false;
     m_timer->Stop();
     Scroll(0, 0);
-    Refresh();
+    InvalidateChart();
 }
 
-void GanttChart::SetProcesses(const std::vector<Process> &processes)
+void GanttChart::SetProcesses(const Workload *workload, const SymbolTable *symbols)
 {
-    m_processes = processes;
-    Refresh();
+    m_workload = workload;
+    m_symbols = symbols;
+    m_lanes.clear();
+    m_segments.clear();
+    m_lodIndex.Clear();
+    m_lastCycle = 0;
+    UpdateVirtualSize();
+    InvalidateChart();
+}
+
+void GanttChart::SetLanes(std::vector<GanttLane> lanes, std::vector<GanttSegment> segments)
+{
+    m_lanes = std::move(lanes);
+    m_segments = std::move(segments);
+    m_lastCycle = 0;
+    for (const auto &seg : m_segments)
+        m_lastCycle = std::max(m_lastCycle, seg.start + seg.length);
+
+    // Indice para la vista alejada
+    std::vector<std::pair<size_t, size_t>> rangos;
+    rangos.reserve(m_lanes.size());
+    for (const auto &lane : m_lanes)
+        rangos.emplace_back(lane.first, lane.count);
+    m_lodIndex.Build(m_segments, rangos);
+
+    UpdateVirtualSize();
+    InvalidateChart();
+}
+
+void GanttChart::UpdateVirtualSize()
+{
+    // El area desplazable cubre todos los carriles y ciclos (al menos la
+    // original de 2000x1000), sin desbordar int con cargas enormes
+    double ancho = 2.0 * kMarginX + m_lastCycle * m_scale;
+    long long alto = kBaseY + static_cast<long long>(m_lanes.size()) * kRowHeight + kMarginX;
+    SetVirtualSize(static_cast<int>(std::min<double>(std::max(ancho, 2000.0), INT_MAX / 2)),
+                   static_cast<int>(std::min<long long>(std::max(alto, 1000LL), INT_MAX / 2)));
+}
+
+void GanttChart::ZoomBy(double factor, int clientX)
+{
+    // Alejado como maximo hasta que toda la simulacion quepa en 100px
+    double minimo = std::min(kDefaultPxPerCycle, 100.0 / std::max(1, m_lastCycle));
+    double escala = std::min(kMaxPxPerCycle, std::max(minimo, m_scale * factor));
+    if (escala == m_scale)
+        return;
+
+    // Mantener fijo el ciclo que esta bajo 'clientX'
+    int vx, vy;
+    CalcUnscrolledPosition(clientX, 0, &vx, &vy);
+    double ciclo = (vx - kMarginX) / m_scale;
+    m_scale = escala;
+    UpdateVirtualSize();
+
+    int x, y;
+    GetViewStart(&x, &y);
+    Scroll(std::max(0, (CycleX(ciclo) - clientX) / kScrollUnit), y);
+    InvalidateChart();
+}
+
+void GanttChart::ZoomIn()
+{
+    ZoomBy(2, GetClientSize().GetWidth() / 2);
+}
+
+void GanttChart::ZoomOut()
+{
+    ZoomBy(0.5, GetClientSize().GetWidth() / 2);
+}
+
+void GanttChart::ZoomToFit()
+{
+    // Toda la simulacion en el ancho visible
+    int ancho = std::max(100, GetClientSize().GetWidth() - 2 * kMarginX);
+    m_scale = std::min(kMaxPxPerCycle, static_cast<double>(ancho) / std::max(1, m_lastCycle));
+    UpdateVirtualSize();
+    int x, y;
+    GetViewStart(&x, &y);
+    Scroll(0, y);
+    InvalidateChart();
+}
+
+void GanttChart::SetSummary(GanttSummary summary)
+{
+    m_summary = summary;
+    InvalidateChart();
+}
+
+void GanttChart::OnMouseWheel(wxMouseEvent &event)
+{
+    // Ctrl + rueda: zoom centrado en el puntero; sin Ctrl, scroll normal
+    if (!event.ControlDown())
+    {
+        event.Skip();
+        return;
+    }
+    ZoomBy(event.GetWheelRotation() > 0 ? 2 : 0.5, event.GetX());
+}
+
+// Implementaciones del barrido de quantum
+SweepPlot::SweepPlot(wxWindow *parent, const std::vector<QuantumSweepPoint> &points)
+    : wxPanel(parent, wxID_ANY, wxDefaultPosition, wxSize(480, 400), wxFULL_REPAINT_ON_RESIZE),
+      m_points(points)
+{
+    SetBackgroundColour(*wxWHITE);
+}
+
+void SweepPlot::OnPaint(wxPaintEvent &event)
+{
+    wxPaintDC dc(this);
+    dc.SetBackground(*wxWHITE_BRUSH);
+    dc.Clear();
+
+    if (m_points.empty())
+    {
+        dc.DrawText("Sin resultados", 10, 10);
+        return;
+    }
+
+    const int left = 50, right = 20, top = 20, bottom = 70;
+    wxSize size = GetClientSize();
+    int w = size.GetWidth() - left - right;
+    int h = size.GetHeight() - top - bottom;
+    if (w <= 0 || h <= 0)
+        return;
+
+    // Ejes
+    dc.SetPen(*wxBLACK_PEN);
+    dc.SetTextForeground(*wxBLACK);
+    dc.DrawLine(left, top + h, left + w, top + h);
+    dc.DrawLine(left, top, left, top + h);
+
+    int qMin = m_points.front().quantum;
+    int qMax = m_points.back().quantum;
+    auto xDe = [&](int q)
+    {
+        return qMax == qMin ? left + w / 2 : left + static_cast<int>((long long)(q - qMin) * w / (qMax - qMin));
+    };
+
+    // Marcas del eje X (unas 10 como maximo)
+    size_t saltoMarca = std::max<size_t>(1, m_points.size() / 10);
+    for (size_t k = 0; k < m_points.size(); k += saltoMarca)
+    {
+        int x = xDe(m_points[k].quantum);
+        dc.DrawLine(x, top + h, x, top + h + 4);
+        dc.DrawText(wxString::Format("%d", m_points[k].quantum), x - 5, top + h + 6);
+    }
+    dc.DrawText("Quantum", left + w / 2 - 25, top + h + 22);
+
+    // Cada metrica se normaliza a su propio maximo; la leyenda muestra la escala
+    struct Serie
+    {
+        const char *nombre;
+        wxColour color;
+        double (*valor)(const SchedMetrics &);
+    };
+    const Serie series[] = {
+        {"Avg Waiting", wxColour(200, 0, 0), [](const SchedMetrics &m)
+         { return m.avgWaitingTime; }},
+        {"Avg Turnaround", wxColour(0, 0, 200), [](const SchedMetrics &m)
+         { return m.avgTurnaroundTime; }},
+        {"Throughput", wxColour(0, 150, 0), [](const SchedMetrics &m)
+         { return m.throughput; }},
+        {"Context Switches", wxColour(200, 120, 0), [](const SchedMetrics &m)
+         { return double(m.contextSwitches); }},
+    };
+
+    int legendX = left;
+    int legendY = top + h + 44;
+    for (const Serie &serie : series)
+    {
+        double maximo = 0.0;
+        for (const auto &pt : m_points)
+            maximo = std::max(maximo, serie.valor(pt.metrics));
+        if (maximo <= 0.0)
+            maximo = 1.0;
+
+        std::vector<wxPoint> puntos;
+        puntos.reserve(m_points.size());
+        for (const auto &pt : m_points)
+        {
+            int y = top + h - static_cast<int>(serie.valor(pt.metrics) / maximo * h);
+            puntos.push_back(wxPoint(xDe(pt.quantum), y));
+        }
+
+        dc.SetPen(wxPen(serie.color, 2));
+        if (puntos.size() > 1)
+            dc.DrawLines(static_cast<int>(puntos.size()), puntos.data());
+        else
+            dc.DrawCircle(puntos.front().x, puntos.front().y, 3);
+
+        dc.SetBrush(wxBrush(serie.color));
+        dc.DrawRectangle(legendX, legendY + 3, 10, 10);
+        wxString etiqueta = wxString::Format("%s (max %.2f)", serie.nombre, maximo);
+        dc.DrawText(etiqueta, legendX + 14, legendY);
+        legendX += dc.GetTextExtent(etiqueta).GetWidth() + 30;
+    }
+}
+
+QuantumSweepDialog::QuantumSweepDialog(wxWindow *parent, const std::vector<QuantumSweepPoint> &points)
+    : wxDialog(parent, wxID_ANY, "Barrido de Quantum (Round Robin)", wxDefaultPosition,
+               wxSize(1000, 600), wxDEFAULT_DIALOG_STYLE | wxRESIZE_BORDER)
+{
+    // Tabla: una fila por quantum
+    wxGrid *grid = new wxGrid(this, wxID_ANY, wxDefaultPosition, wxSize(460, 400));
+    grid->CreateGrid(static_cast<int>(points.size()), 5);
+    grid->SetColLabelValue(0, "Quantum");
+    grid->SetColLabelValue(1, "Avg Waiting");
+    grid->SetColLabelValue(2, "Avg Turnaround");
+    grid->SetColLabelValue(3, "Throughput");
+    grid->SetColLabelValue(4, "Context Switches");
+    for (size_t k = 0; k < points.size(); ++k)
+    {
+        int row = static_cast<int>(k);
+        const SchedMetrics &m = points[k].metrics;
+        grid->SetCellValue(row, 0, wxString::Format("%d", points[k].quantum));
+        grid->SetCellValue(row, 1, wxString::Format("%.2f", m.avgWaitingTime));
+        grid->SetCellValue(row, 2, wxString::Format("%.2f", m.avgTurnaroundTime));
+        grid->SetCellValue(row, 3, wxString::Format("%.4f", m.throughput));
+        grid->SetCellValue(row, 4, wxString::Format("%d", m.contextSwitches));
+    }
+    grid->EnableEditing(false);
+    grid->AutoSizeColumns();
+
+    wxBoxSizer *contenido = new wxBoxSizer(wxHORIZONTAL);
+    contenido->Add(grid, 0, wxEXPAND | wxALL, 5);
+    contenido->Add(new SweepPlot(this, points), 1, wxEXPAND | wxALL, 5);
+
+    wxBoxSizer *mainSizer = new wxBoxSizer(wxVERTICAL);
+    mainSizer->Add(contenido, 1, wxEXPAND | wxALL, 5);
+    mainSizer->Add(CreateButtonSizer(wxOK), 0, wxEXPAND | wxALL, 5);
+    SetSizer(mainSizer);
+}
+
+ParallelismDialog::ParallelismDialog(wxWindow *parent, const wxString &mode, const SymbolTable &symbols,
+                                     const std::vector<SyncResource> &resources,
+                                     const SyncTimeline &timeline, const SyncTimeline &mutex)
+    : wxDialog(parent, wxID_ANY, "Paralelismo por recurso", wxDefaultPosition,
+               wxSize(760, 480), wxDEFAULT_DIALOG_STYLE | wxRESIZE_BORDER)
+{
+    // Resumen: ciclos hasta la ultima liberacion con el mecanismo actual y con mutex
+    wxString resumen = wxString::Format("Mecanismo: %s\nCiclos hasta la ultima liberacion: %d (Mutex: %d)",
+                                        mode, timeline.finishCycle, mutex.finishCycle);
+    if (timeline.finishCycle > 0)
+        resumen += wxString::Format("\nGanancia sobre Mutex: %.2fx",
+                                    static_cast<double>(mutex.finishCycle) / timeline.finishCycle);
+
+    // Tabla: una fila por recurso cargado (los repetidos una sola vez)
+    std::vector<const SyncResource *> filas;
+    std::vector<char> visto(timeline.resources.size(), 0);
+    for (const auto &r : resources)
+    {
+        if (static_cast<size_t>(r.name) < visto.size() && !visto[r.name])
+        {
+            visto[r.name] = 1;
+            filas.push_back(&r);
+        }
+    }
+
+    wxGrid *grid = new wxGrid(this, wxID_ANY, wxDefaultPosition, wxSize(720, 360));
+    grid->CreateGrid(static_cast<int>(filas.size()), 6);
+    grid->SetColLabelValue(0, "Recurso");
+    grid->SetColLabelValue(1, "Accesos");
+    grid->SetColLabelValue(2, "Max. Simultaneos");
+    grid->SetColLabelValue(3, "Paralelismo Medio");
+    grid->SetColLabelValue(4, "Ciclos Ocupado");
+    grid->SetColLabelValue(5, "Ciclos Ocupado (Mutex)");
+    for (size_t k = 0; k < filas.size(); ++k)
+    {
+        int row = static_cast<int>(k);
+        const SyncResourceStats &s = timeline.resources[filas[k]->name];
+        const SyncResourceStats &m = mutex.resources[filas[k]->name];
+        grid->SetCellValue(row, 0, SymbolLabel(symbols, filas[k]->name));
+        grid->SetCellValue(row, 1, wxString::Format("%d", s.acquisitions));
+        grid->SetCellValue(row, 2, wxString::Format("%d", s.maxHolders));
+        grid->SetCellValue(row, 3, wxString::Format("%.2f", s.Parallelism()));
+        grid->SetCellValue(row, 4, wxString::Format("%lld", s.busyCycles));
+        grid->SetCellValue(row, 5, wxString::Format("%lld", m.busyCycles));
+    }
+    grid->EnableEditing(false);
+    grid->AutoSizeColumns();
+
+    wxBoxSizer *mainSizer = new wxBoxSizer(wxVERTICAL);
+    mainSizer->Add(new wxStaticText(this, wxID_ANY, resumen), 0, wxALL, 10);
+    mainSizer->Add(grid, 1, wxEXPAND | wxALL, 5);
+    mainSizer->Add(CreateButtonSizer(wxOK), 0, wxEXPAND | wxALL, 5);
+    SetSizer(mainSizer);
 }
 
 // Implementaciones para TimelineChart
@@ -1715,7 +2354,7 @@ void TimelineChart::OnPaint(wxPaintEvent &event)
     dc.SetBackground(*wxWHITE_BRUSH);
     dc.Clear();
 
-    if (m_processes.empty() || m_resources.empty() || m_actions.empty())
+    if (!HasData())
     {
         dc.DrawText("Cargar procesos, recursos y acciones", 10, 10);
         return;
@@ -1744,72 +2383,101 @@ void TimelineChart::DrawTimeline(wxPaintDC &dc)
         dc.DrawText(wxString::Format("%d", i), x - 5, baseY + 10);
     }
 
-    // Dibujar acciones por proceso
+    // Zona visible en coordenadas logicas
+    int vx, vy, ancho, alto;
+    CalcUnscrolledPosition(0, 0, &vx, &vy);
+    GetClientSize(&ancho, &alto);
+
+    // Filas de procesos visibles
     int rowHeight = 30;
-    for (size_t i = 0; i < m_processes.size(); ++i)
+    const int filas = static_cast<int>(m_processes->Size());
+    int filaIni = std::min(filas, std::max(0, (vy - baseY - 20 - 20) / rowHeight));
+    int filaFin = std::min(filas, std::max(0, (vy + alto - baseY - 20) / rowHeight + 1));
+    for (int i = filaIni; i < filaFin; ++i)
     {
-        const Process &process = m_processes[i];
-        int y = baseY + 20 + i * rowHeight;
+        dc.DrawText(SymbolLabel(*m_symbols, m_processes->pid[i]), 10, baseY + 20 + i * rowHeight);
+    }
 
-        dc.DrawText(process.pid, 10, y);
+    // Interbloqueo: desde su ciclo se marcan los procesos atrapados y la columna
+    const SyncDeadlock &bloqueo = m_timeline.deadlock;
+    const bool mostrarBloqueo = bloqueo.Found() && m_currentCycle >= bloqueo.cycle;
+    if (mostrarBloqueo)
+    {
+        dc.SetPen(wxPen(wxColour(220, 0, 0), 2));
+        dc.SetBrush(*wxTRANSPARENT_BRUSH);
+        for (int fila : bloqueo.rows)
+            if (fila >= filaIni && fila < filaFin)
+                dc.DrawRectangle(5, baseY + 17 + fila * rowHeight, 40, 24);
+        int x = 50 + bloqueo.cycle * 30 + 12;
+        dc.DrawLine(x, baseY + 15, x, baseY + 20 + filas * rowHeight);
+        dc.SetPen(*wxBLACK_PEN);
+    }
+
+    // Acciones ya llegadas en los ciclos visibles: del indice por ciclo solo
+    // se toman las de los PID de las filas visibles; su estado depende solo
+    // del ciclo actual
+    const wxBrush readBrush(wxColour(100, 200, 100));
+    const wxBrush writeBrush(wxColour(200, 100, 100));
+    const wxBrush waitBrush(wxColour(200, 200, 100));
+    int cicloIni = (vx - 50 - 10) / 30 - 1;
+    int cicloFin = std::min(m_currentCycle, (vx + ancho - 50 + 10) / 30 + 1);
+    dc.SetTextForeground(*wxBLACK);
 
-        for (const Action &action : m_actions)
+    for (size_t b = m_actionIndex->LowerBucket(cicloIni);
+         b < m_actionIndex->Buckets() && m_actionIndex->Cycle(b) <= cicloFin; ++b)
+    {
+        for (int fila = filaIni; fila < filaFin; ++fila)
         {
-            if (action.pid == process.pid && action.cycle <= m_currentCycle)
+            for (const SyncIndexEntry &e : m_actionIndex->OfProcess(b, m_processes->pid[fila]))
             {
-                auto key = std::make_tuple(action.pid, action.resource, action.cycle);
-                int x = 50 + action.cycle * 30;
-                wxColour color;
-
-                // --- lógica de sincronización (mutex/semaforo) ---
-                bool esMutex = (m_syncMode == "Mutex Locks");
+                if (m_timeline.row[e.action] != fila)
+                    continue; // PID repetido: se dibuja en su primera fila
 
-                if (m_actionsDone.count(key))
-                {
-                    // Ya ejecutada, mostrar normalmente
-                    color = (action.action == "READ") ? wxColour(100, 200, 100)
-                                                      : wxColour(200, 100, 100);
-                }
-                else if ((esMutex && m_resourceStates[action.resource] == 1) ||
-                         (!esMutex && m_resourceStates[action.resource] > 0))
-                {
-                    // ACCESSED
-                    color = (action.action == "READ") ? wxColour(100, 200, 100)
-                                                      : wxColour(200, 100, 100);
+                const SyncAction &action = (*m_actions)[e.action];
+                int x = 50 + action.cycle * 30;
+                int y = baseY + 20 + fila * rowHeight;
+                int acceso = m_timeline.acquired[e.action];
 
-                    m_resourceStates[action.resource]--;
-                    m_pendingReleases[action.resource].push(m_currentCycle + 1); // liberar en siguiente ciclo
-                    m_actionsDone.insert(key);
-                }
+                if (acceso != kSyncNever && acceso <= m_currentCycle)
+                    dc.SetBrush(action.action == m_readId ? readBrush : writeBrush); // ACCESSED
                 else
-                {
-                    // WAITING
-                    color = wxColour(200, 200, 100);
-                }
-
-                dc.SetBrush(wxBrush(color));
+                    dc.SetBrush(waitBrush); // WAITING
                 dc.DrawRectangle(x - 10, y, 20, 20);
-                dc.SetTextForeground(*wxBLACK);
-                dc.DrawText(action.action.Left(1), x - 5, y + 2);
+                dc.DrawText(SymbolLabel(*m_symbols, action.action).Left(1), x - 5, y + 2);
             }
         }
     }
 
     // Leyenda
-    int legendY = baseY + 20 + m_processes.size() * rowHeight + 20;
+    int legendY = baseY + 20 + m_processes->Size() * rowHeight + 20;
     dc.DrawText("Leyenda:", 10, legendY);
 
-    dc.SetBrush(wxBrush(wxColour(100, 200, 100)));
+    dc.SetBrush(readBrush);
     dc.DrawRectangle(80, legendY, 15, 15);
     dc.DrawText("READ", 100, legendY);
 
-    dc.SetBrush(wxBrush(wxColour(200, 100, 100)));
+    dc.SetBrush(writeBrush);
     dc.DrawRectangle(150, legendY, 15, 15);
     dc.DrawText("WRITE", 170, legendY);
 
-    dc.SetBrush(wxBrush(wxColour(200, 200, 100)));
+    dc.SetBrush(waitBrush);
     dc.DrawRectangle(220, legendY, 15, 15);
     dc.DrawText("WAITING", 240, legendY);
+
+    // Quien espera que recurso dentro del interbloqueo (los primeros)
+    if (mostrarBloqueo)
+    {
+        const size_t kMaxListados = 8;
+        wxString texto = wxString::Format("INTERBLOQUEO en el ciclo %d:", bloqueo.cycle);
+        for (size_t k = 0; k < bloqueo.rows.size() && k < kMaxListados; ++k)
+            texto += " " + SymbolLabel(*m_symbols, m_processes->pid[bloqueo.rows[k]]) + " espera " +
+                     SymbolLabel(*m_symbols, bloqueo.resources[k]) + ";";
+        if (bloqueo.rows.size() > kMaxListados)
+            texto += wxString::Format(" ... (%zu procesos)", bloqueo.rows.size());
+        dc.SetTextForeground(wxColour(200, 0, 0));
+        dc.DrawText(texto, 10, legendY + 25);
+        dc.SetTextForeground(*wxBLACK);
+    }
 }
 
 void TimelineChart::OnTimer(wxTimerEvent &event)
@@ -1818,15 +2486,6 @@ void TimelineChart::OnTimer(wxTimerEvent &event)
     {
         m_currentCycle++;
 
-        for (auto &[recurso, ciclos] : m_pendingReleases)
-        {
-            while (!ciclos.empty() && ciclos.front() == m_currentCycle)
-            {
-                m_resourceStates[recurso]++;
-                ciclos.pop();
-            }
-        }
-
         // Scroll automático si se pasa del ancho visible
         int x, y;
         GetViewStart(&x, &y);
@@ -1837,14 +2496,8 @@ void TimelineChart::OnTimer(wxTimerEvent &event)
 
         Refresh();
 
-        // Detener cuando se hayan procesado todas las acciones
-        int maxCycle = 0;
-        for (const Action &action : m_actions)
-        {
-            maxCycle = std::max(maxCycle, action.cycle);
-        }
-
-        if (m_currentCycle > maxCycle + 5)
+        // Detener en el ultimo ciclo de la linea de tiempo
+        if (m_currentCycle >= m_timeline.lastCycle)
         {
             StopSimulation();
         }
@@ -1865,30 +2518,71 @@ void TimelineChart::StopSimulation()
 
 void TimelineChart::ResetChart()
 {
+    // La simulacion ya esta calculada: reiniciar es volver al ciclo 0
     m_currentCycle = 0;
     m_isRunning = false;
     m_timer->Stop();
     Scroll(0, 0);
-    m_actionStartCycle.clear();
     Refresh();
 }
 
-void TimelineChart::SetData(const std::vector<Process> &processes, const std::vector<Resource> &resources, const std::vector<Action> &actions)
+bool TimelineChart::HasData() const
+{
+    return m_processes && !m_processes->Empty() && m_resources && !m_resources->empty() &&
+           m_actions && !m_actions->empty() && m_actionIndex;
+}
+
+void TimelineChart::Simulate()
+{
+    m_syncOptions.readAction = m_readId;
+    m_timeline = HasData() ? SimulateSync(*m_processes, *m_resources, *m_actions, *m_actionIndex, m_syncOptions)
+                           : SyncTimeline();
+    Refresh();
+    if (m_onSimulated)
+        m_onSimulated();
+}
+
+void TimelineChart::SetData(const Workload *processes, const std::vector<SyncResource> *resources,
+                            const std::vector<SyncAction> *actions, const SyncActionIndex *actionIndex,
+                            const SymbolTable *symbols)
 {
     m_processes = processes;
     m_resources = resources;
     m_actions = actions;
-    m_resourceStates.clear();
-    m_actionsDone.clear();
+    m_actionIndex = actionIndex;
+    m_symbols = symbols;
+    m_readId = symbols->Find("READ");
+    Simulate();
+}
 
-    for (const auto &r : resources)
-    {
-        m_resourceStates[r.name] = r.counter;
-    }
+void TimelineChart::ClearData()
+{
+    StopSimulation();
+    m_currentCycle = 0;
+    m_processes = nullptr;
+    m_resources = nullptr;
+    m_actions = nullptr;
+    m_actionIndex = nullptr;
+    Simulate();
+}
 
-    Refresh();
+void TimelineChart::SetSyncOptions(const SyncOptions &options)
+{
+    m_syncOptions = options;
+    Simulate();
 }
 
 // Punto de entrada de la aplicacion
 
-wxIMPLEMENT_APP(OSSimulatorApp);
\ No newline at end of file
+wxIMPLEMENT_APP_NO_MAIN(OSSimulatorApp);
+
+int main(int argc, char **argv)
+{
+    // "--headless" ejecuta el modo batch sin inicializar wxWidgets
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::string(argv[i]) == "--headless")
+            return RunHeadless(argc, argv);
+    }
+    return wxEntry(argc, argv);
+}
\ No newline at end of file
@@ -0,0 +1,73 @@
+#include "mapped_file.h"
+
+#include <fstream>
+#include <iterator>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFile::~MappedFile()
+{
+    Close();
+}
+
+bool MappedFile::Open(const std::string &filename)
+{
+    Close();
+
+#ifndef _WIN32
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    struct stat info;
+    if (::fstat(fd, &info) != 0)
+    {
+        ::close(fd);
+        return false;
+    }
+
+    // Un archivo vacio no se puede proyectar, pero es valido
+    if (info.st_size == 0)
+    {
+        ::close(fd);
+        return true;
+    }
+
+    void *addr = ::mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd); // la proyeccion sigue valida sin el descriptor
+    if (addr != MAP_FAILED)
+    {
+        ::madvise(addr, static_cast<size_t>(info.st_size), MADV_SEQUENTIAL);
+        m_data = static_cast<const char *>(addr);
+        m_size = static_cast<size_t>(info.st_size);
+        m_mapped = true;
+        return true;
+    }
+#endif
+
+    // Respaldo: leer el archivo completo a memoria
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open())
+        return false;
+    m_buffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    m_data = m_buffer.data();
+    m_size = m_buffer.size();
+    return true;
+}
+
+void MappedFile::Close()
+{
+#ifndef _WIN32
+    if (m_mapped)
+        ::munmap(const_cast<char *>(m_data), m_size);
+#endif
+    m_data = nullptr;
+    m_size = 0;
+    m_mapped = false;
+    m_buffer.clear();
+}
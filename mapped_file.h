@@ -0,0 +1,33 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+// Archivo de solo lectura proyectado en memoria (mmap). Los cargadores lo
+// recorren directamente sin copiarlo ni dividirlo en strings.
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+class MappedFile
+{
+public:
+    MappedFile() = default;
+    ~MappedFile();
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    // Devuelve false si el archivo no existe o no se puede leer
+    bool Open(const std::string &filename);
+    void Close();
+
+    const char *Data() const { return m_data; }
+    size_t Size() const { return m_size; }
+
+private:
+    const char *m_data = nullptr;
+    size_t m_size = 0;
+    bool m_mapped = false;
+    std::vector<char> m_buffer; // respaldo cuando no hay mmap disponible
+};
+
+#endif // MAPPED_FILE_H
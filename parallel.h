@@ -0,0 +1,71 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+// Grupo de hilos minimo para repartir trabajos independientes del motor
+// (varios algoritmos, barridos de quantum, bloques de un archivo).
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Numero de hilos a usar: 'requested' si es mayor que 0, si no todos los nucleos
+inline unsigned WorkerCount(unsigned requested)
+{
+    if (requested > 0)
+        return requested;
+    unsigned hw = std::thread::hardware_concurrency();
+    return hw > 0 ? hw : 1;
+}
+
+// Ejecuta fn(i) para cada i en [0, count). Cada hilo toma el siguiente indice
+// libre, de modo que los trabajos largos no bloquean a los cortos. La primera
+// excepcion lanzada por un trabajo se relanza en el hilo que llama.
+template <typename Fn>
+void ParallelFor(size_t count, Fn fn, unsigned threads = 0)
+{
+    unsigned workers = static_cast<unsigned>(std::min<size_t>(WorkerCount(threads), count));
+    if (workers <= 1)
+    {
+        for (size_t i = 0; i < count; ++i)
+            fn(i);
+        return;
+    }
+
+    std::atomic<size_t> siguiente(0);
+    std::exception_ptr error;
+    std::mutex errorMutex;
+
+    auto worker = [&]()
+    {
+        for (size_t i = siguiente++; i < count; i = siguiente++)
+        {
+            try
+            {
+                fn(i);
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(errorMutex);
+                if (!error)
+                    error = std::current_exception();
+            }
+        }
+    };
+
+    std::vector<std::thread> pool;
+    pool.reserve(workers - 1);
+    for (unsigned t = 1; t < workers; ++t)
+        pool.emplace_back(worker);
+    worker(); // el hilo que llama tambien trabaja
+    for (auto &th : pool)
+        th.join();
+
+    if (error)
+        std::rethrow_exception(error);
+}
+
+#endif // PARALLEL_H
@@ -0,0 +1,1665 @@
+#include "scheduler.h"
+
+#include <algorithm>
+#include <cctype>
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <map>
+#include <numeric>
+#include <queue>
+#include <set>
+
+#include "parallel.h"
+
+namespace
+{
+    const size_t kNinguno = size_t(-1);
+
+    // Construye un ScheduleResult. Los algoritmos anotan cada despacho en
+    // orden de tiempo; Finish los agrupa por proceso en el arreglo de
+    // segmentos y calcula las metricas.
+    class ResultBuilder
+    {
+    public:
+        explicit ResultBuilder(size_t n)
+        {
+            m_result.startTime.assign(n, -1);
+            m_result.finishTime.assign(n, -1);
+            m_result.waitingTime.assign(n, 0);
+        }
+
+        std::vector<int> &StartTime() { return m_result.startTime; }
+        std::vector<int> &FinishTime() { return m_result.finishTime; }
+        std::vector<int> &WaitingTime() { return m_result.waitingTime; }
+
+        // Numero de CPUs simulados (uno si no se llama)
+        void SetCpus(int cpus)
+        {
+            m_result.cpus = cpus;
+            m_ultimo.assign(size_t(cpus), kNinguno);
+        }
+
+        // Registra un despacho en el CPU 'cpu'; 'merge' une el tramo con el
+        // anterior de ese CPU si es del mismo proceso y empieza justo donde
+        // aquel termino. Cada CPU debe registrar sus tramos en orden de tiempo.
+        void Dispatch(size_t proc, int start, int length, bool merge = false, int cpu = 0)
+        {
+            size_t &ultimo = m_ultimo[cpu];
+            if (merge && ultimo != kNinguno && m_log[ultimo].proc == proc &&
+                m_log[ultimo].start + m_log[ultimo].length == start)
+            {
+                m_log[ultimo].length += length;
+                return;
+            }
+            ultimo = m_log.size();
+            m_log.push_back({start, length, proc, cpu});
+        }
+
+        ScheduleResult Finish(const Workload &procs)
+        {
+            const size_t n = procs.Size();
+            ScheduleResult &r = m_result;
+
+            // 1) Agrupar los despachos por proceso (conteo + prefijos), conservando
+            //    el orden de tiempo dentro de cada proceso
+            r.segmentOffset.assign(n + 1, 0);
+            for (const auto &d : m_log)
+                r.segmentOffset[d.proc + 1]++;
+            for (size_t i = 0; i < n; ++i)
+                r.segmentOffset[i + 1] += r.segmentOffset[i];
+
+            const bool smp = r.cpus > 1;
+            std::vector<size_t> siguiente(r.segmentOffset.begin(), r.segmentOffset.end() - 1);
+            r.segments.resize(m_log.size());
+            if (smp)
+                r.segmentCpu.resize(m_log.size());
+            for (const auto &d : m_log)
+            {
+                size_t k = siguiente[d.proc]++;
+                r.segments[k] = {d.start, d.length};
+                if (smp)
+                    r.segmentCpu[k] = d.cpu;
+            }
+
+            // 2) Mayor espera continua de cada proceso: de la llegada al primer
+            //    tramo y entre tramos (sin tramos, de la llegada al final)
+            SchedMetrics &m = r.metrics;
+            r.maxWaitTime.assign(n, 0);
+            for (size_t i = 0; i < n; ++i)
+            {
+                int listo = procs.arrivalTime[i];
+                int mayor = 0;
+                for (size_t k = r.segmentOffset[i]; k < r.segmentOffset[i + 1]; ++k)
+                {
+                    mayor = std::max(mayor, r.segments[k].start - listo);
+                    listo = r.segments[k].start + r.segments[k].length;
+                }
+                if (r.segmentOffset[i] == r.segmentOffset[i + 1])
+                    mayor = std::max(0, r.finishTime[i] - listo);
+                r.maxWaitTime[i] = mayor;
+                m.maxWaitTime = std::max(m.maxWaitTime, mayor);
+            }
+
+            // 3) Metricas
+            if (n > 0)
+            {
+                double sumaWT = 0.0, sumaTAT = 0.0;
+                int ultimoFin = 0;
+                for (size_t i = 0; i < n; ++i)
+                {
+                    sumaWT += r.waitingTime[i];
+                    sumaTAT += (r.finishTime[i] - procs.arrivalTime[i]);
+                    ultimoFin = std::max(ultimoFin, r.finishTime[i]);
+                }
+
+                m.avgWaitingTime = sumaWT / n;
+                m.avgTurnaroundTime = sumaTAT / n;
+                m.throughput = ultimoFin > 0 ? double(n) / double(ultimoFin) : 0.0;
+                m.makespan = ultimoFin;
+            }
+
+            // Cambios de contexto: despachos consecutivos de procesos distintos en
+            // el mismo CPU. El registro de cada CPU ya esta en orden de tiempo;
+            // los tramos vacios no cuentan.
+            std::vector<const Dispatched *> anterior(m_ultimo.size(), nullptr);
+            for (const auto &d : m_log)
+            {
+                if (d.length <= 0)
+                    continue;
+                if (anterior[d.cpu] && anterior[d.cpu]->proc != d.proc)
+                    m.contextSwitches++;
+                anterior[d.cpu] = &d;
+            }
+
+            // Migraciones: tramos consecutivos de un proceso en CPUs distintos
+            if (smp)
+            {
+                for (size_t i = 0; i < n; ++i)
+                {
+                    int cpuAnterior = -1;
+                    for (size_t k = r.segmentOffset[i]; k < r.segmentOffset[i + 1]; ++k)
+                    {
+                        if (r.segments[k].length <= 0)
+                            continue;
+                        if (cpuAnterior >= 0 && cpuAnterior != r.segmentCpu[k])
+                            m.migrations++;
+                        cpuAnterior = r.segmentCpu[k];
+                    }
+                }
+            }
+
+            m_log.clear();
+            m_log.shrink_to_fit();
+            return std::move(m_result);
+        }
+
+    private:
+        struct Dispatched
+        {
+            int start;
+            int length;
+            size_t proc;
+            int cpu;
+        };
+
+        ScheduleResult m_result;
+        std::vector<Dispatched> m_log;
+        std::vector<size_t> m_ultimo = std::vector<size_t>(1, kNinguno); // ultimo tramo de cada CPU
+    };
+
+    // Indices de los procesos ordenados por arrivalTime (estable: empates por orden de entrada)
+    std::vector<size_t> SortedByArrival(const Workload &procs)
+    {
+        std::vector<size_t> orden(procs.Size());
+        for (size_t i = 0; i < orden.size(); ++i)
+            orden[i] = i;
+        const std::vector<int> &llegada = procs.arrivalTime;
+        std::stable_sort(orden.begin(), orden.end(), [&](size_t a, size_t b)
+                         { return llegada[a] < llegada[b]; });
+        return orden;
+    }
+
+    // Orden de FIFO: por arrivalTime y, en caso de empate, por PID (por su
+    // nombre si se conoce la tabla de simbolos, si no por su ID)
+    std::vector<size_t> FifoOrder(const Workload &procs, const SymbolTable *symbols)
+    {
+        const std::vector<int> &llegada = procs.arrivalTime;
+        const std::vector<int> &pid = procs.pid;
+        std::vector<size_t> orden(procs.Size());
+        for (size_t i = 0; i < orden.size(); ++i)
+            orden[i] = i;
+        std::stable_sort(orden.begin(), orden.end(), [&](size_t a, size_t b)
+                         {
+            if (llegada[a] != llegada[b])
+                return llegada[a] < llegada[b];
+            if (symbols)
+                return symbols->Name(pid[a]) < symbols->Name(pid[b]);
+            return pid[a] < pid[b]; });
+        return orden;
+    }
+
+    // Cola de MLFQ: una FIFO por nivel y un mapa de bits con los niveles que
+    // tienen procesos. El nivel mas alto no vacio es el bit menos significativo
+    // encendido, asi que elegir el siguiente proceso no depende de los niveles.
+    class MultiLevelQueue
+    {
+    public:
+        static constexpr int kMaxLevels = kMaxMlfqLevels;
+        static_assert(kMaxLevels <= 64, "el mapa de niveles es de 64 bits");
+
+        explicit MultiLevelQueue(int levels) : m_niveles(size_t(levels)) {}
+
+        bool Empty() const { return m_mapa == 0; }
+
+        // Nivel mas alto (menor indice) con procesos; la cola no debe estar vacia
+        int TopLevel() const { return __builtin_ctzll(m_mapa); }
+
+        void Push(int level, size_t proc)
+        {
+            m_niveles[level].push(proc);
+            m_mapa |= uint64_t(1) << level;
+        }
+
+        size_t Pop(int level)
+        {
+            std::queue<size_t> &cola = m_niveles[level];
+            size_t proc = cola.front();
+            cola.pop();
+            if (cola.empty())
+                m_mapa &= ~(uint64_t(1) << level);
+            return proc;
+        }
+
+        // Sube todos los procesos al nivel 0 conservando el orden (primero los
+        // de los niveles mas altos); fn(proc) se llama para cada uno
+        template <typename Fn>
+        void Boost(Fn fn)
+        {
+            std::queue<size_t> &cima = m_niveles[0];
+            for (size_t k = cima.size(); k > 0; --k)
+            {
+                fn(cima.front());
+                cima.push(cima.front());
+                cima.pop();
+            }
+            for (uint64_t resto = m_mapa & ~uint64_t(1); resto != 0; resto &= resto - 1)
+            {
+                std::queue<size_t> &cola = m_niveles[__builtin_ctzll(resto)];
+                for (; !cola.empty(); cola.pop())
+                {
+                    fn(cola.front());
+                    cima.push(cola.front());
+                }
+            }
+            m_mapa = cima.empty() ? 0 : 1;
+        }
+
+    private:
+        std::vector<std::queue<size_t>> m_niveles;
+        uint64_t m_mapa = 0;
+    };
+
+    // Peso de cada nice (-20 a 19) en el calendarizador de Linux; nice 0 = 1024
+    // y cada nivel pesa ~1.25 veces el siguiente
+    const int kNiceWeight[40] = {
+        88761, 71755, 56483, 46273, 36291,
+        29154, 23254, 18705, 14949, 11916,
+        9548, 7620, 6100, 4904, 3906,
+        3121, 2501, 1991, 1586, 1277,
+        1024, 820, 655, 526, 423,
+        335, 272, 215, 172, 137,
+        110, 87, 70, 56, 45,
+        36, 29, 23, 18, 15};
+    const long long kNice0Weight = 1024;
+
+    // Ciclos ejecutados con 'peso' convertidos a vruntime, en 1/1024 de ciclo
+    // de un proceso de nice 0
+    long long VirtualTime(long long ciclos, int peso)
+    {
+        return ciclos * kNice0Weight * 1024 / peso;
+    }
+
+    // Calendarizador no expropiativo generico sobre un heap binario: despacha
+    // siempre el proceso listo con menor clave. Los empates se resuelven por
+    // arrivalTime y luego por orden de entrada, de modo que el resultado es
+    // estable. Costo O(n log n).
+    ScheduleResult RunNonPreemptive(const Workload &procs, const std::vector<int> &key)
+    {
+        struct Entry
+        {
+            int key;
+            int arrival;
+            size_t index;
+        };
+        // priority_queue es un max-heap: "mayor" significa que sale despues
+        auto despues = [](const Entry &a, const Entry &b)
+        {
+            if (a.key != b.key)
+                return a.key > b.key;
+            if (a.arrival != b.arrival)
+                return a.arrival > b.arrival;
+            return a.index > b.index;
+        };
+
+        const std::vector<int> &llegada = procs.arrivalTime;
+        const std::vector<int> &rafaga = procs.burstTime;
+        ResultBuilder out(procs.Size());
+        std::vector<size_t> ordenados = SortedByArrival(procs);
+
+        std::vector<Entry> storage;
+        storage.reserve(procs.Size());
+        std::priority_queue<Entry, std::vector<Entry>, decltype(despues)> readyQueue(despues, std::move(storage));
+
+        int currentCycle = 0;
+        size_t idx = 0;
+        while (idx < ordenados.size() || !readyQueue.empty())
+        {
+            // 1) Mover al heap todos los procesos cuya arrivalTime <= currentCycle
+            while (idx < ordenados.size() && llegada[ordenados[idx]] <= currentCycle)
+            {
+                size_t i = ordenados[idx++];
+                readyQueue.push({key[i], llegada[i], i});
+            }
+
+            // 2) Si no hay procesos listos, avanzar al proximo arrivalTime
+            if (readyQueue.empty())
+            {
+                currentCycle = llegada[ordenados[idx]];
+                continue;
+            }
+
+            // 3) Despachar el de menor clave y escribir el resultado en su indice
+            size_t elegido = readyQueue.top().index;
+            readyQueue.pop();
+
+            int inicio = std::max(currentCycle, llegada[elegido]);
+            out.StartTime()[elegido] = inicio;
+            out.FinishTime()[elegido] = inicio + rafaga[elegido];
+            out.WaitingTime()[elegido] = inicio - llegada[elegido];
+            out.Dispatch(elegido, inicio, rafaga[elegido]);
+            currentCycle = inicio + rafaga[elegido];
+        }
+
+        return out.Finish(procs);
+    }
+
+    // Horizonte automatico de EDF y RM: ultima llegada periodica mas el
+    // hiperperiodo, que deja de crecer al pasar de kMaxAutoHorizon (0 si no
+    // hay tareas periodicas)
+    int AutoHorizon(const Workload &procs)
+    {
+        long long hiperperiodo = 1;
+        int ultimaLlegada = 0;
+        bool periodicas = false;
+        for (size_t i = 0; i < procs.Size(); ++i)
+        {
+            long long p = procs.period[i];
+            if (p <= 0)
+                continue;
+            periodicas = true;
+            ultimaLlegada = std::max(ultimaLlegada, procs.arrivalTime[i]);
+            if (hiperperiodo <= kMaxAutoHorizon)
+                hiperperiodo = hiperperiodo / std::gcd(hiperperiodo, p) * p;
+        }
+        if (!periodicas)
+            return 0;
+        hiperperiodo = std::min<long long>(hiperperiodo, kMaxAutoHorizon);
+        return static_cast<int>(std::min<long long>(ultimaLlegada + hiperperiodo, INT_MAX));
+    }
+
+    // EDF y RM: calendarizador expropiativo por trabajos sobre dos heaps, el de
+    // liberaciones pendientes y el de trabajos listos. 'porDeadline' elige la
+    // clave de los listos: deadline absoluto (EDF) o periodo (RM).
+    ScheduleResult RunRealTime(const Workload &procs, int horizon, bool porDeadline)
+    {
+        const size_t n = procs.Size();
+        const std::vector<int> &rafaga = procs.burstTime;
+        const std::vector<int> &periodo = procs.period;
+        ResultBuilder out(n);
+        std::vector<int> &startTime = out.StartTime();
+        std::vector<int> &finishTime = out.FinishTime();
+        if (horizon <= 0)
+            horizon = AutoHorizon(procs);
+
+        RealTimeStats rt;
+        rt.jobs.assign(n, 0);
+        rt.misses.assign(n, 0);
+        rt.maxLateness.assign(n, 0);
+        rt.horizon = horizon;
+        for (size_t i = 0; i < n; ++i)
+        {
+            if (periodo[i] > 0)
+                rt.maxLateness[i] = INT_MIN; // lo reemplaza su primer trabajo
+        }
+        std::vector<int> maxEspera(n, 0);
+        std::vector<long long> esperaTotal(n, 0); // suma de la espera de los trabajos
+
+        // 1) Trabajos listos; los que no tienen deadline llevan la peor clave
+        const long long kSinDeadline = LLONG_MAX;
+        struct Trabajo
+        {
+            long long key;
+            int release;
+            size_t seq;
+            size_t proc;
+            int restante;
+            int listo; // ciclo desde el que espera sin correr
+        };
+        auto despues = [](const Trabajo &a, const Trabajo &b)
+        {
+            if (a.key != b.key)
+                return a.key > b.key;
+            if (a.release != b.release)
+                return a.release > b.release;
+            return a.seq > b.seq;
+        };
+        std::priority_queue<Trabajo, std::vector<Trabajo>, decltype(despues)> listos(despues);
+
+        // 2) Liberaciones pendientes (ciclo, orden de llegada): la primera de
+        //    cada proceso; cada tarea periodica agrega la siguiente al liberar
+        struct Liberacion
+        {
+            int cycle;
+            size_t seq;
+            size_t proc;
+        };
+        auto masTarde = [](const Liberacion &a, const Liberacion &b)
+        {
+            if (a.cycle != b.cycle)
+                return a.cycle > b.cycle;
+            return a.seq > b.seq;
+        };
+        std::vector<size_t> arrivals = SortedByArrival(procs);
+        std::vector<Liberacion> iniciales(n);
+        for (size_t k = 0; k < n; ++k)
+            iniciales[k] = {procs.arrivalTime[arrivals[k]], k, arrivals[k]};
+        std::priority_queue<Liberacion, std::vector<Liberacion>, decltype(masTarde)>
+            liberaciones(masTarde, std::move(iniciales));
+
+        // 3) Cierre de un trabajo: tiempos del proceso y lateness
+        auto terminar = [&](const Trabajo &t, int ciclo)
+        {
+            size_t i = t.proc;
+            finishTime[i] = std::max(finishTime[i], ciclo);
+            esperaTotal[i] += ciclo - t.release - std::max(rafaga[i], 0);
+            if (periodo[i] <= 0)
+                return;
+            int lateness = static_cast<int>(ciclo - (static_cast<long long>(t.release) + periodo[i]));
+            rt.maxLateness[i] = std::max(rt.maxLateness[i], lateness);
+            if (lateness > 0)
+                rt.misses[i]++;
+        };
+
+        bool corriendo = false;
+        Trabajo actual = {};
+        int inicio = 0;
+        int currentCycle = 0;
+
+        while (corriendo || !listos.empty() || !liberaciones.empty())
+        {
+            // 4a) Liberaciones vencidas
+            while (!liberaciones.empty() && liberaciones.top().cycle <= currentCycle)
+            {
+                Liberacion l = liberaciones.top();
+                liberaciones.pop();
+                size_t i = l.proc;
+                long long clave = kSinDeadline;
+                if (periodo[i] > 0)
+                    clave = porDeadline ? static_cast<long long>(l.cycle) + periodo[i] : periodo[i];
+                listos.push({clave, l.cycle, l.seq, i, rafaga[i], l.cycle});
+                rt.jobs[i]++;
+                if (periodo[i] > 0 && static_cast<long long>(l.cycle) + periodo[i] < horizon)
+                    liberaciones.push({l.cycle + periodo[i], l.seq, i});
+            }
+
+            // 4b) Expropiar si hay un trabajo listo con mejor clave
+            if (corriendo && !listos.empty() && despues(actual, listos.top()))
+            {
+                out.Dispatch(actual.proc, inicio, currentCycle - inicio);
+                actual.listo = currentCycle;
+                listos.push(actual);
+                corriendo = false;
+            }
+
+            // 4c) CPU libre: el trabajo de mejor clave
+            if (!corriendo)
+            {
+                if (listos.empty())
+                {
+                    // CPU ociosa: saltar a la siguiente liberacion
+                    currentCycle = liberaciones.top().cycle;
+                    continue;
+                }
+                actual = listos.top();
+                listos.pop();
+                maxEspera[actual.proc] = std::max(maxEspera[actual.proc], currentCycle - actual.listo);
+                if (startTime[actual.proc] < 0)
+                    startTime[actual.proc] = currentCycle;
+                if (actual.restante <= 0)
+                {
+                    // Sin rafaga: termina en cuanto se despacha
+                    out.Dispatch(actual.proc, currentCycle, 0);
+                    terminar(actual, currentCycle);
+                    continue;
+                }
+                corriendo = true;
+                inicio = currentCycle;
+            }
+
+            // 4d) Correr hasta terminar o hasta la siguiente liberacion
+            int fin = currentCycle + actual.restante;
+            if (!liberaciones.empty())
+                fin = std::min(fin, liberaciones.top().cycle);
+            actual.restante -= fin - currentCycle;
+            currentCycle = fin;
+
+            if (actual.restante == 0)
+            {
+                out.Dispatch(actual.proc, inicio, currentCycle - inicio);
+                terminar(actual, currentCycle);
+                corriendo = false;
+            }
+        }
+
+        // 5) Totales y prueba de utilizacion. La espera de cada proceso es la
+        //    promedio por trabajo, en la misma escala que su tiempo de retorno.
+        for (size_t i = 0; i < n; ++i)
+            out.WaitingTime()[i] = static_cast<int>(esperaTotal[i] / std::max(rt.jobs[i], 1));
+        int tareas = 0;
+        rt.worstLateness = INT_MIN;
+        for (size_t i = 0; i < n; ++i)
+        {
+            rt.totalJobs += rt.jobs[i];
+            rt.totalMisses += rt.misses[i];
+            if (periodo[i] <= 0)
+                continue;
+            tareas++;
+            rt.worstLateness = std::max(rt.worstLateness, rt.maxLateness[i]);
+            rt.utilization += std::max(rafaga[i], 0) / double(periodo[i]);
+        }
+        if (tareas == 0)
+            rt.worstLateness = 0;
+        if (porDeadline || tareas == 0)
+            rt.utilizationBound = 1.0;
+        else
+            rt.utilizationBound = tareas * (std::pow(2.0, 1.0 / tareas) - 1.0);
+
+        // Finish mide la espera entre los tramos de todo el proceso; en una
+        // tarea periodica solo cuenta la de cada trabajo ya liberado
+        ScheduleResult result = out.Finish(procs);
+        result.maxWaitTime = std::move(maxEspera);
+        result.metrics.maxWaitTime = 0;
+        for (int espera : result.maxWaitTime)
+            result.metrics.maxWaitTime = std::max(result.metrics.maxWaitTime, espera);
+        result.realtime = std::move(rt);
+        return result;
+    }
+}
+
+ScheduleResult ScheduleFIFO(const Workload &procs, const SymbolTable *symbols)
+{
+    const std::vector<int> &llegada = procs.arrivalTime;
+    const std::vector<int> &rafaga = procs.burstTime;
+    ResultBuilder out(procs.Size());
+
+    // 1) Ordenar indices por arrivalTime; en caso de empate, desempatar por PID
+    std::vector<size_t> orden = FifoOrder(procs, symbols);
+
+    // 2) Recorrer en orden y calcular startTime/finishTime/waitingTime
+    int currentCycle = 0;
+    for (size_t i : orden)
+    {
+        int inicio = std::max(currentCycle, llegada[i]);
+        out.StartTime()[i] = inicio;
+        out.FinishTime()[i] = inicio + rafaga[i];
+        out.WaitingTime()[i] = inicio - llegada[i];
+        out.Dispatch(i, inicio, rafaga[i]);
+        currentCycle = inicio + rafaga[i];
+    }
+
+    return out.Finish(procs);
+}
+
+ScheduleResult ScheduleSJF(const Workload &procs)
+{
+    // Menor burstTime primero
+    return RunNonPreemptive(procs, procs.burstTime);
+}
+
+ScheduleResult ScheduleSRT(const Workload &procs)
+{
+    // Estado de un proceso listo. 'seq' es su posicion en el orden de llegada y
+    // desempata igual que la version que avanzaba ciclo por ciclo.
+    struct ExecState
+    {
+        int remainingTime;
+        size_t seq;
+        size_t proc;
+    };
+    auto despues = [](const ExecState &a, const ExecState &b)
+    {
+        if (a.remainingTime != b.remainingTime)
+            return a.remainingTime > b.remainingTime;
+        return a.seq > b.seq;
+    };
+
+    const size_t n = procs.Size();
+    const std::vector<int> &llegada = procs.arrivalTime;
+    const std::vector<int> &rafaga = procs.burstTime;
+    ResultBuilder out(n);
+    std::vector<int> &startTime = out.StartTime();
+    std::vector<int> &finishTime = out.FinishTime();
+
+    // 1) Ordenar indices por arrivalTime para insertar en readyQueue
+    std::vector<size_t> arrivals = SortedByArrival(procs);
+
+    std::vector<ExecState> storage;
+    storage.reserve(n);
+    std::priority_queue<ExecState, std::vector<ExecState>, decltype(despues)> readyQueue(despues, std::move(storage));
+
+    size_t idx = 0;
+    size_t completed = 0;
+    int currentCycle = 0;
+
+    // 2) Ciclo principal: solo se detiene en llegadas y terminaciones
+    while (completed < n)
+    {
+        // 2a) Agregar todos los procesos que ya llegaron
+        while (idx < n && llegada[arrivals[idx]] <= currentCycle)
+        {
+            size_t i = arrivals[idx];
+            if (rafaga[i] <= 0)
+            {
+                // Sin rafaga: termina en cuanto llega
+                finishTime[i] = currentCycle;
+                completed++;
+            }
+            else
+            {
+                readyQueue.push({rafaga[i], idx, i});
+            }
+            idx++;
+        }
+
+        // 2b) CPU ociosa: saltar directamente a la siguiente llegada
+        if (readyQueue.empty())
+        {
+            if (idx < n)
+                currentCycle = llegada[arrivals[idx]];
+            continue;
+        }
+
+        // 2c) El de menor remainingTime corre hasta terminar o hasta la siguiente
+        // llegada, que es el unico momento en que puede ser expropiado
+        ExecState exec = readyQueue.top();
+        readyQueue.pop();
+        int run = exec.remainingTime;
+        if (idx < n)
+            run = std::min(run, llegada[arrivals[idx]] - currentCycle);
+
+        // 2d) Registrar segmento, uniendo tramos contiguos del mismo proceso
+        if (startTime[exec.proc] < 0)
+            startTime[exec.proc] = currentCycle;
+        out.Dispatch(exec.proc, currentCycle, run, true);
+
+        currentCycle += run;
+        exec.remainingTime -= run;
+        if (exec.remainingTime == 0)
+        {
+            finishTime[exec.proc] = currentCycle;
+            completed++;
+        }
+        else
+        {
+            readyQueue.push(exec);
+        }
+    }
+
+    // 3) Calcular startTime (si nunca corrio) y waitingTime
+    for (size_t i = 0; i < n; ++i)
+    {
+        if (startTime[i] < 0)
+            startTime[i] = finishTime[i];
+        out.WaitingTime()[i] = finishTime[i] - llegada[i] - std::max(rafaga[i], 0);
+    }
+
+    return out.Finish(procs);
+}
+
+ScheduleResult ScheduleRR(const Workload &procs, int quantum)
+{
+    const size_t n = procs.Size();
+    const std::vector<int> &llegada = procs.arrivalTime;
+    ResultBuilder out(n);
+    std::vector<int> &startTime = out.StartTime();
+    std::vector<int> &finishTime = out.FinishTime();
+    if (quantum < 1)
+        quantum = 1;
+
+    // Llegadas preordenadas; 'idx' es el cursor sobre la siguiente por llegar
+    std::vector<size_t> arrivals = SortedByArrival(procs);
+    size_t idx = 0;
+
+    std::vector<int> remainingBT(procs.burstTime);
+
+    // La cola guarda indices enteros de proceso
+    std::queue<size_t> readyQueue;
+    int currentCycle = 0;
+    size_t completed = 0;
+
+    auto encolarLlegadas = [&]()
+    {
+        while (idx < n && llegada[arrivals[idx]] <= currentCycle)
+        {
+            readyQueue.push(arrivals[idx]);
+            idx++;
+        }
+    };
+
+    while (completed < n)
+    {
+        // Agregar procesos que ya llegaron
+        encolarLlegadas();
+
+        if (readyQueue.empty())
+        {
+            // CPU ociosa: saltar a la siguiente llegada
+            currentCycle = llegada[arrivals[idx]];
+            continue;
+        }
+
+        size_t index = readyQueue.front();
+        readyQueue.pop();
+
+        int execTime = std::max(0, std::min(quantum, remainingBT[index]));
+
+        // Añadir segmento RR
+        if (startTime[index] < 0)
+            startTime[index] = currentCycle;
+        out.Dispatch(index, currentCycle, execTime);
+
+        remainingBT[index] -= execTime;
+        currentCycle += execTime;
+
+        // Procesos que llegaron mientras este ejecutaba van antes que el expropiado
+        encolarLlegadas();
+
+        if (remainingBT[index] > 0)
+        {
+            readyQueue.push(index); // volver a encolar
+        }
+        else
+        {
+            finishTime[index] = currentCycle;
+            completed++;
+        }
+    }
+
+    // Una sola pasada para waitingTime
+    for (size_t i = 0; i < n; ++i)
+    {
+        out.WaitingTime()[i] = finishTime[i] - llegada[i] - std::max(procs.burstTime[i], 0);
+    }
+
+    return out.Finish(procs);
+}
+
+ScheduleResult SchedulePriority(const Workload &procs)
+{
+    // Menor valor de prioridad = mayor prioridad
+    return RunNonPreemptive(procs, procs.priority);
+}
+
+ScheduleResult ScheduleMLFQ(const Workload &procs, int levels, const std::vector<int> &quanta,
+                            int boostInterval)
+{
+    const size_t n = procs.Size();
+    const std::vector<int> &llegada = procs.arrivalTime;
+    ResultBuilder out(n);
+    std::vector<int> &startTime = out.StartTime();
+    std::vector<int> &finishTime = out.FinishTime();
+
+    // 1) Quantum de cada nivel; los que faltan duplican el anterior
+    levels = std::min(std::max(levels, 1), MultiLevelQueue::kMaxLevels);
+    std::vector<int> cuota(size_t(levels), 1);
+    for (int l = 0; l < levels; ++l)
+    {
+        if (size_t(l) < quanta.size())
+            cuota[l] = std::max(1, quanta[l]);
+        else if (l > 0)
+            cuota[l] = cuota[l - 1] > INT_MAX / 2 ? INT_MAX : cuota[l - 1] * 2;
+    }
+
+    std::vector<size_t> arrivals = SortedByArrival(procs);
+    size_t idx = 0;
+    std::vector<int> restante(procs.burstTime);
+    std::vector<int> nivel(n, 0);
+    std::vector<int> usado(n, 0); // ciclos consumidos del quantum de su nivel
+
+    MultiLevelQueue cola(levels);
+    int currentCycle = 0;
+    size_t completed = 0;
+    int proximoBoost = boostInterval > 0 ? boostInterval : INT_MAX;
+    bool pendiente = false; // el ultimo proceso en correr espera volver a la cola
+    bool continua = false;  // el ultimo proceso sigue en la CPU tras una subida
+    size_t ultimo = 0;
+
+    while (completed < n)
+    {
+        // 2) Llegadas al nivel 0; el proceso que acaba de correr va detras de
+        //    ellas, como en Round Robin
+        while (idx < n && llegada[arrivals[idx]] <= currentCycle)
+            cola.Push(0, arrivals[idx++]);
+        if (pendiente)
+        {
+            cola.Push(nivel[ultimo], ultimo);
+            pendiente = false;
+        }
+
+        // 3) Subida periodica de todos los procesos al nivel 0
+        if (currentCycle >= proximoBoost)
+        {
+            cola.Boost([&](size_t i)
+                       { nivel[i] = 0; usado[i] = 0; });
+            proximoBoost = currentCycle - currentCycle % boostInterval + boostInterval;
+        }
+
+        // 4) Primer proceso del nivel mas alto con procesos. La subida no
+        //    expropia: el que estaba en la CPU sigue, ya en el nivel 0.
+        int l = 0;
+        size_t index = ultimo;
+        if (continua)
+        {
+            nivel[index] = 0;
+            usado[index] = 0;
+            continua = false;
+        }
+        else if (cola.Empty())
+        {
+            // CPU ociosa: saltar a la siguiente llegada
+            currentCycle = llegada[arrivals[idx]];
+            continue;
+        }
+        else
+        {
+            l = cola.TopLevel();
+            index = cola.Pop(l);
+        }
+        if (startTime[index] < 0)
+            startTime[index] = currentCycle;
+        if (restante[index] <= 0)
+        {
+            // Sin rafaga: termina en cuanto se despacha
+            out.Dispatch(index, currentCycle, 0);
+            finishTime[index] = currentCycle;
+            completed++;
+            continue;
+        }
+
+        // 5) Corre hasta agotar su quantum, terminar o la siguiente subida. Si
+        //    no esta en el nivel 0, una llegada lo expropia.
+        int fin = currentCycle + std::min(cuota[l] - usado[index], restante[index]);
+        fin = std::min(fin, proximoBoost);
+        bool expropiable = l > 0 && idx < n;
+        if (expropiable)
+            fin = std::min(fin, llegada[arrivals[idx]]);
+        int run = fin - currentCycle;
+        out.Dispatch(index, currentCycle, run, true);
+        restante[index] -= run;
+        usado[index] += run;
+        currentCycle = fin;
+
+        if (restante[index] == 0)
+        {
+            finishTime[index] = currentCycle;
+            completed++;
+            continue;
+        }
+        if (usado[index] >= cuota[l])
+        {
+            // Agoto el quantum: baja un nivel
+            nivel[index] = std::min(l + 1, levels - 1);
+            usado[index] = 0;
+            pendiente = true;
+        }
+        else
+        {
+            // Interrumpido por una llegada (vuelve a la cola) o por la subida
+            pendiente = expropiable && llegada[arrivals[idx]] <= currentCycle;
+            continua = !pendiente;
+        }
+        ultimo = index;
+    }
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        out.WaitingTime()[i] = finishTime[i] - llegada[i] - std::max(procs.burstTime[i], 0);
+    }
+
+    return out.Finish(procs);
+}
+
+ScheduleResult SchedulePreemptivePriority(const Workload &procs, int agingInterval, int agingCap)
+{
+    const size_t n = procs.Size();
+    const std::vector<int> &llegada = procs.arrivalTime;
+    const std::vector<int> &prioridad = procs.priority;
+    ResultBuilder out(n);
+    std::vector<int> &startTime = out.StartTime();
+    std::vector<int> &finishTime = out.FinishTime();
+    const bool envejecer = agingInterval > 0;
+
+    // 1) Cubetas por prioridad efectiva: listas doblemente enlazadas sobre los
+    //    indices de proceso, para sacar uno de en medio en O(1)
+    struct Cubeta
+    {
+        size_t primero = kNinguno;
+        size_t ultimo = kNinguno;
+    };
+    std::map<int, Cubeta> cubetas;
+    std::vector<size_t> anterior(n, kNinguno), siguiente(n, kNinguno);
+    std::vector<int> ganado(n, 0); // niveles ganados esperando (hasta agingCap)
+
+    auto agregar = [&](size_t i)
+    {
+        Cubeta &c = cubetas[prioridad[i] - ganado[i]];
+        anterior[i] = c.ultimo;
+        siguiente[i] = kNinguno;
+        if (c.ultimo != kNinguno)
+            siguiente[c.ultimo] = i;
+        else
+            c.primero = i;
+        c.ultimo = i;
+    };
+    auto quitar = [&](size_t i)
+    {
+        auto it = cubetas.find(prioridad[i] - ganado[i]);
+        Cubeta &c = it->second;
+        if (anterior[i] != kNinguno)
+            siguiente[anterior[i]] = siguiente[i];
+        else
+            c.primero = siguiente[i];
+        if (siguiente[i] != kNinguno)
+            anterior[siguiente[i]] = anterior[i];
+        else
+            c.ultimo = anterior[i];
+        if (c.primero == kNinguno)
+            cubetas.erase(it);
+    };
+
+    // 2) Calendario de envejecimientos (ciclo, orden de llegada); 'version'
+    //    invalida los pendientes de un proceso que sale de la cola
+    struct Envejecer
+    {
+        int cycle;
+        size_t seq;
+        size_t proc;
+        unsigned version;
+    };
+    auto despues = [](const Envejecer &a, const Envejecer &b)
+    {
+        if (a.cycle != b.cycle)
+            return a.cycle > b.cycle;
+        return a.seq > b.seq;
+    };
+    std::priority_queue<Envejecer, std::vector<Envejecer>, decltype(despues)> calendario(despues);
+    std::vector<unsigned> version(n, 0);
+    std::vector<size_t> seqDe(n);
+
+    auto encolar = [&](size_t i, int ciclo)
+    {
+        ganado[i] = 0;
+        agregar(i);
+        if (envejecer && prioridad[i] > agingCap && ciclo <= INT_MAX - agingInterval)
+            calendario.push({ciclo + agingInterval, seqDe[i], i, version[i]});
+    };
+    auto vigente = [&](const Envejecer &e)
+    { return e.version == version[e.proc]; };
+
+    std::vector<size_t> arrivals = SortedByArrival(procs);
+    for (size_t k = 0; k < n; ++k)
+        seqDe[arrivals[k]] = k;
+    size_t idx = 0;
+    std::vector<int> restante(procs.burstTime);
+
+    bool corriendo = false;
+    size_t actual = 0;
+    int efectiva = 0; // prioridad con la que corre 'actual'
+    int inicio = 0;
+    int currentCycle = 0;
+    size_t completed = 0;
+
+    while (completed < n)
+    {
+        // 3a) Envejecimientos vencidos: cada uno sube un nivel a su proceso
+        while (!calendario.empty() && calendario.top().cycle <= currentCycle)
+        {
+            Envejecer e = calendario.top();
+            calendario.pop();
+            if (!vigente(e))
+                continue;
+            quitar(e.proc);
+            ganado[e.proc]++;
+            agregar(e.proc);
+            if (prioridad[e.proc] - ganado[e.proc] > agingCap && e.cycle <= INT_MAX - agingInterval)
+                calendario.push({e.cycle + agingInterval, e.seq, e.proc, e.version});
+        }
+
+        // 3b) Llegadas a la cubeta de su prioridad
+        while (idx < n && llegada[arrivals[idx]] <= currentCycle)
+            encolar(arrivals[idx++], currentCycle);
+
+        // 3c) Expropiar si hay un listo con prioridad estrictamente mejor
+        if (corriendo && !cubetas.empty() && cubetas.begin()->first < efectiva)
+        {
+            out.Dispatch(actual, inicio, currentCycle - inicio);
+            corriendo = false;
+            encolar(actual, currentCycle);
+        }
+
+        // 3d) CPU libre: el primero de la mejor cubeta
+        if (!corriendo)
+        {
+            if (cubetas.empty())
+            {
+                // CPU ociosa: saltar a la siguiente llegada
+                currentCycle = llegada[arrivals[idx]];
+                continue;
+            }
+            actual = cubetas.begin()->second.primero;
+            efectiva = cubetas.begin()->first;
+            quitar(actual);
+            version[actual]++;
+            if (startTime[actual] < 0)
+                startTime[actual] = currentCycle;
+            if (restante[actual] <= 0)
+            {
+                // Sin rafaga: termina en cuanto se despacha
+                out.Dispatch(actual, currentCycle, 0);
+                finishTime[actual] = currentCycle;
+                completed++;
+                continue;
+            }
+            corriendo = true;
+            inicio = currentCycle;
+        }
+
+        // 3e) Correr hasta terminar o hasta el siguiente evento que pueda
+        //     expropiarlo (una llegada o un envejecimiento)
+        int fin = currentCycle + restante[actual];
+        if (idx < n)
+            fin = std::min(fin, llegada[arrivals[idx]]);
+        while (!calendario.empty() && !vigente(calendario.top()))
+            calendario.pop();
+        if (!calendario.empty())
+            fin = std::min(fin, calendario.top().cycle);
+        restante[actual] -= fin - currentCycle;
+        currentCycle = fin;
+
+        if (restante[actual] == 0)
+        {
+            out.Dispatch(actual, inicio, currentCycle - inicio);
+            finishTime[actual] = currentCycle;
+            completed++;
+            corriendo = false;
+        }
+    }
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        out.WaitingTime()[i] = finishTime[i] - llegada[i] - std::max(procs.burstTime[i], 0);
+    }
+
+    return out.Finish(procs);
+}
+
+ScheduleResult ScheduleCFS(const Workload &procs, int targetLatency, int minGranularity)
+{
+    const size_t n = procs.Size();
+    const std::vector<int> &llegada = procs.arrivalTime;
+    ResultBuilder out(n);
+    std::vector<int> &startTime = out.StartTime();
+    std::vector<int> &finishTime = out.FinishTime();
+    minGranularity = std::max(1, minGranularity);
+    targetLatency = std::max(minGranularity, targetLatency);
+
+    // 1) Peso de cada proceso segun su prioridad (nice)
+    std::vector<int> peso(n);
+    for (size_t i = 0; i < n; ++i)
+        peso[i] = kNiceWeight[std::min(std::max(procs.priority[i], -20), 19) + 20];
+
+    std::vector<size_t> arrivals = SortedByArrival(procs);
+    size_t idx = 0;
+    std::vector<int> restante(procs.burstTime);
+
+    // vruntime = el de entrada mas el tiempo ejecutado escalado por el peso;
+    // se calcula sobre el total para no acumular errores de redondeo
+    std::vector<long long> vInicio(n, 0);
+    auto vruntime = [&](size_t i)
+    { return vInicio[i] + VirtualTime(procs.burstTime[i] - restante[i], peso[i]); };
+
+    // Procesos listos ordenados por (vruntime, orden de llegada)
+    std::set<std::pair<long long, size_t>> arbol;
+    long long minVruntime = 0;
+    long long pesoTotal = 0; // listos y el que corre
+
+    bool corriendo = false;
+    size_t actual = 0, seqActual = 0;
+    int finTurno = 0;
+    int currentCycle = 0;
+    size_t completed = 0;
+
+    while (completed < n)
+    {
+        // 2) Llegadas: entran con el vruntime minimo y expropian al actual si
+        //    este les lleva mas de una granularidad
+        bool expropiar = false;
+        while (idx < n && llegada[arrivals[idx]] <= currentCycle)
+        {
+            size_t i = arrivals[idx];
+            vInicio[i] = minVruntime;
+            arbol.insert({minVruntime, idx});
+            pesoTotal += peso[i];
+            if (corriendo && vruntime(actual) - minVruntime > VirtualTime(minGranularity, peso[i]))
+                expropiar = true;
+            idx++;
+        }
+        if (expropiar)
+        {
+            arbol.insert({vruntime(actual), seqActual});
+            corriendo = false;
+        }
+
+        // 3) CPU libre: elegir el de menor vruntime y calcular su turno
+        if (!corriendo)
+        {
+            if (arbol.empty())
+            {
+                // CPU ociosa: saltar a la siguiente llegada
+                currentCycle = llegada[arrivals[idx]];
+                continue;
+            }
+            seqActual = arbol.begin()->second;
+            actual = arrivals[seqActual];
+            arbol.erase(arbol.begin());
+            if (startTime[actual] < 0)
+                startTime[actual] = currentCycle;
+            if (restante[actual] <= 0)
+            {
+                // Sin rafaga: termina en cuanto se despacha
+                out.Dispatch(actual, currentCycle, 0);
+                finishTime[actual] = currentCycle;
+                completed++;
+                pesoTotal -= peso[actual];
+                continue;
+            }
+
+            long long periodo = std::max<long long>(targetLatency, (long long)(arbol.size() + 1) * minGranularity);
+            long long turno = std::max<long long>(minGranularity, periodo * peso[actual] / pesoTotal);
+            finTurno = currentCycle + static_cast<int>(std::min<long long>(turno, restante[actual]));
+            corriendo = true;
+        }
+
+        // 4) Correr hasta el fin del turno o la siguiente llegada
+        int fin = finTurno;
+        if (idx < n)
+            fin = std::min(fin, llegada[arrivals[idx]]);
+        int run = fin - currentCycle;
+        out.Dispatch(actual, currentCycle, run, true);
+        restante[actual] -= run;
+        currentCycle = fin;
+
+        if (restante[actual] == 0)
+        {
+            finishTime[actual] = currentCycle;
+            completed++;
+            pesoTotal -= peso[actual];
+            corriendo = false;
+        }
+        else if (currentCycle == finTurno)
+        {
+            arbol.insert({vruntime(actual), seqActual});
+            corriendo = false;
+        }
+
+        // 5) El vruntime minimo solo avanza (lo usan las llegadas)
+        long long minimo = LLONG_MAX;
+        if (corriendo)
+            minimo = vruntime(actual);
+        if (!arbol.empty())
+            minimo = std::min(minimo, arbol.begin()->first);
+        if (minimo != LLONG_MAX)
+            minVruntime = std::max(minVruntime, minimo);
+    }
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        out.WaitingTime()[i] = finishTime[i] - llegada[i] - std::max(procs.burstTime[i], 0);
+    }
+
+    return out.Finish(procs);
+}
+
+ScheduleResult ScheduleEDF(const Workload &procs, int horizon)
+{
+    return RunRealTime(procs, horizon, true);
+}
+
+ScheduleResult ScheduleRM(const Workload &procs, int horizon)
+{
+    return RunRealTime(procs, horizon, false);
+}
+
+ScheduleResult ScheduleSMP(Algorithm alg, const Workload &procs, const SchedulerOptions &options)
+{
+    if (alg == Algorithm::MLFQ)
+        return ScheduleMLFQ(procs, options.mlfqLevels, options.mlfqQuanta, options.mlfqBoost);
+    if (alg == Algorithm::CFS)
+        return ScheduleCFS(procs, options.cfsTargetLatency, options.cfsMinGranularity);
+    if (alg == Algorithm::PriorityP)
+        return SchedulePreemptivePriority(procs, options.agingInterval, options.agingCap);
+    if (alg == Algorithm::EDF)
+        return ScheduleEDF(procs, options.realtimeHorizon);
+    if (alg == Algorithm::RM)
+        return ScheduleRM(procs, options.realtimeHorizon);
+
+    // Proceso listo; 'seq' es su posicion en el orden de llegada y desempata
+    // igual que las versiones de un solo CPU
+    struct Entry
+    {
+        long long key;
+        size_t seq;
+        size_t proc;
+    };
+    struct Despues
+    {
+        bool operator()(const Entry &a, const Entry &b) const
+        {
+            if (a.key != b.key)
+                return a.key > b.key;
+            return a.seq > b.seq;
+        }
+    };
+    using ReadyQueue = std::priority_queue<Entry, std::vector<Entry>, Despues>;
+
+    // Tramo en curso de un CPU: corre 'proc' en [inicio, fin)
+    struct Cpu
+    {
+        bool ocupado = false;
+        size_t proc = 0;
+        size_t seq = 0;
+        int inicio = 0;
+        int fin = 0;
+    };
+
+    const size_t n = procs.Size();
+    const int cpus = std::max(1, options.cpus);
+    const bool global = cpus == 1 || options.balance == LoadBalance::Global;
+    const bool migrar = !global && options.balance == LoadBalance::Push;
+    const bool robar = !global && options.balance == LoadBalance::WorkStealing;
+    const bool expropiativo = alg == Algorithm::SRT;
+    const int quantum = std::max(1, options.quantum);
+    const int intervalo = std::max(1, options.balanceInterval);
+    const std::vector<int> &llegada = procs.arrivalTime;
+    const std::vector<int> &rafaga = procs.burstTime;
+
+    ResultBuilder out(n);
+    out.SetCpus(cpus);
+    std::vector<int> &startTime = out.StartTime();
+    std::vector<int> &finishTime = out.FinishTime();
+
+    // 1) Orden de llegada (FIFO desempata por PID) y tiempo restante de cada proceso
+    std::vector<size_t> arrivals = alg == Algorithm::FIFO ? FifoOrder(procs, options.symbols)
+                                                          : SortedByArrival(procs);
+    std::vector<int> restante(n);
+    for (size_t i = 0; i < n; ++i)
+        restante[i] = std::max(rafaga[i], 0);
+
+    // Clave de orden en la cola segun el algoritmo; RR usa un turno creciente
+    long long turno = 0;
+    auto clave = [&](size_t i, size_t seq) -> long long
+    {
+        switch (alg)
+        {
+        case Algorithm::SJF:
+            return rafaga[i];
+        case Algorithm::SRT:
+            return restante[i];
+        case Algorithm::RR:
+            return turno++;
+        case Algorithm::Priority:
+            return procs.priority[i];
+        case Algorithm::FIFO:
+        case Algorithm::MLFQ:
+        case Algorithm::CFS:
+        case Algorithm::PriorityP:
+        case Algorithm::EDF:
+        case Algorithm::RM:
+            break;
+        }
+        return static_cast<long long>(seq);
+    };
+
+    // 2) Una cola por CPU, o una sola compartida con balanceo global
+    std::vector<ReadyQueue> colas(global ? 1 : cpus);
+    auto colaDe = [&](int c) -> ReadyQueue &
+    { return colas[global ? 0 : c]; };
+    std::vector<Cpu> cpu(cpus);
+    size_t enCola = 0; // procesos listos en todas las colas
+
+    // Robo de trabajo: el CPU 'c' toma el siguiente proceso de la cola mas larga
+    auto robarPara = [&](int c)
+    {
+        if (enCola == 0)
+            return false;
+        int victima = -1;
+        for (int v = 0; v < cpus; ++v)
+            if (!colas[v].empty() && (victima < 0 || colas[v].size() > colas[victima].size()))
+                victima = v;
+        if (victima < 0)
+            return false;
+        colas[c].push(colas[victima].top());
+        colas[victima].pop();
+        return true;
+    };
+
+    // Migracion: mover procesos del CPU mas cargado (cola + el que corre) al
+    // menos cargado hasta que la diferencia sea menor que 2
+    auto migrarColas = [&]()
+    {
+        for (;;)
+        {
+            int mayor = 0, menor = 0;
+            std::vector<size_t> carga(cpus);
+            for (int c = 0; c < cpus; ++c)
+            {
+                carga[c] = colas[c].size() + (cpu[c].ocupado ? 1 : 0);
+                if (carga[c] > carga[mayor])
+                    mayor = c;
+                if (carga[c] < carga[menor])
+                    menor = c;
+            }
+            if (carga[mayor] < carga[menor] + 2)
+                return;
+            colas[menor].push(colas[mayor].top());
+            colas[mayor].pop();
+        }
+    };
+
+    // Cierra el tramo del CPU 'c' en el ciclo 't'
+    auto cerrarTramo = [&](int c, int t)
+    {
+        Cpu &k = cpu[c];
+        if (t > k.inicio)
+            out.Dispatch(k.proc, k.inicio, t - k.inicio, expropiativo, c);
+        restante[k.proc] -= t - k.inicio;
+        k.ocupado = false;
+    };
+
+    // SRT: 'c' deja su proceso si en su cola hay uno con menos tiempo restante
+    auto expropiar = [&](int c, int t)
+    {
+        Cpu &k = cpu[c];
+        ReadyQueue &cola = colaDe(c);
+        if (!k.ocupado || cola.empty())
+            return false;
+        Entry actual{restante[k.proc] - (t - k.inicio), k.seq, k.proc};
+        if (!Despues()(actual, cola.top()))
+            return false;
+        cerrarTramo(c, t);
+        cola.push({restante[actual.proc], actual.seq, actual.proc});
+        Entry e = cola.top();
+        cola.pop();
+        if (startTime[e.proc] < 0)
+            startTime[e.proc] = t;
+        k = {true, e.proc, e.seq, t, t + restante[e.proc]};
+        return true;
+    };
+
+    // RR: procesos que agotaron el quantum en este ciclo y el CPU donde corrian
+    struct Vencido
+    {
+        size_t proc;
+        size_t seq;
+        int cpu;
+    };
+    std::vector<Vencido> vencidos;
+    size_t idx = 0;
+    size_t completed = 0;
+    int t = 0;
+    int proximoBalanceo = INT_MIN;
+
+    // 3) Ciclo principal: solo se detiene en llegadas, fines de tramo y rondas
+    //    de migracion
+    while (completed < n)
+    {
+        // 3a) Cerrar los tramos que terminan en 't'
+        for (int c = 0; c < cpus; ++c)
+        {
+            Cpu &k = cpu[c];
+            if (!k.ocupado || k.fin != t)
+                continue;
+            cerrarTramo(c, t);
+            if (restante[k.proc] > 0)
+            {
+                vencidos.push_back({k.proc, k.seq, c});
+            }
+            else
+            {
+                finishTime[k.proc] = t;
+                completed++;
+            }
+        }
+
+        // 3b) Encolar las llegadas (repartidas entre los CPUs por turno); en RR
+        //     van antes que los procesos expropiados en este mismo ciclo
+        while (idx < n && llegada[arrivals[idx]] <= t)
+        {
+            size_t i = arrivals[idx];
+            if (expropiativo && restante[i] <= 0)
+            {
+                // Sin rafaga: termina en cuanto llega
+                startTime[i] = finishTime[i] = t;
+                completed++;
+            }
+            else
+            {
+                colaDe(int(idx % cpus)).push({clave(i, idx), idx, i});
+                enCola++;
+            }
+            idx++;
+        }
+        for (const Vencido &v : vencidos)
+            colaDe(v.cpu).push({clave(v.proc, v.seq), v.seq, v.proc});
+        enCola += vencidos.size();
+        vencidos.clear();
+
+        // 3c) Balanceo por migracion cada 'intervalo' ciclos
+        if (migrar && t >= proximoBalanceo)
+        {
+            migrarColas();
+            proximoBalanceo = t + intervalo;
+        }
+
+        // 3d) Cada CPU libre toma el primero de su cola (o roba uno). Los
+        //     procesos sin rafaga terminan al instante y el CPU sigue libre.
+        for (int c = 0; c < cpus; ++c)
+        {
+            Cpu &k = cpu[c];
+            ReadyQueue &cola = colaDe(c);
+            while (!k.ocupado)
+            {
+                if (cola.empty() && !(robar && robarPara(c)))
+                    break;
+                Entry e = cola.top();
+                cola.pop();
+                enCola--;
+                if (startTime[e.proc] < 0)
+                    startTime[e.proc] = t;
+                int tramo = alg == Algorithm::RR ? std::min(quantum, restante[e.proc]) : restante[e.proc];
+                if (tramo <= 0)
+                {
+                    out.Dispatch(e.proc, t, 0, false, c);
+                    finishTime[e.proc] = t;
+                    completed++;
+                    continue;
+                }
+                k = {true, e.proc, e.seq, t, t + tramo};
+            }
+        }
+
+        // 3e) SRT: expropiar si hay un proceso listo con menos tiempo restante.
+        //     Con cola global se expropia siempre al peor de los que corren.
+        if (expropiativo)
+        {
+            if (global)
+            {
+                for (;;)
+                {
+                    int peor = -1;
+                    for (int c = 0; c < cpus; ++c)
+                    {
+                        if (!cpu[c].ocupado)
+                            continue;
+                        Entry e{restante[cpu[c].proc] - (t - cpu[c].inicio), cpu[c].seq, cpu[c].proc};
+                        if (peor < 0 || Despues()(e, Entry{restante[cpu[peor].proc] - (t - cpu[peor].inicio),
+                                                           cpu[peor].seq, cpu[peor].proc}))
+                            peor = c;
+                    }
+                    if (peor < 0 || !expropiar(peor, t))
+                        break;
+                }
+            }
+            else
+            {
+                for (int c = 0; c < cpus; ++c)
+                    expropiar(c, t);
+            }
+        }
+
+        // 3f) Saltar al siguiente evento
+        int siguiente = INT_MAX;
+        if (idx < n)
+            siguiente = llegada[arrivals[idx]];
+        for (int c = 0; c < cpus; ++c)
+            if (cpu[c].ocupado)
+                siguiente = std::min(siguiente, cpu[c].fin);
+        if (migrar && enCola > 0)
+            siguiente = std::min(siguiente, proximoBalanceo);
+        if (siguiente == INT_MAX)
+            break;
+        t = siguiente;
+    }
+
+    // 4) waitingTime: tiempo en el sistema sin ejecutar
+    for (size_t i = 0; i < n; ++i)
+    {
+        if (startTime[i] < 0)
+            startTime[i] = finishTime[i];
+        out.WaitingTime()[i] = finishTime[i] - llegada[i] - std::max(rafaga[i], 0);
+    }
+
+    return out.Finish(procs);
+}
+
+ScheduleResult RunScheduler(Algorithm alg, const Workload &procs, const SchedulerOptions &options)
+{
+    if (options.cpus > 1)
+        return ScheduleSMP(alg, procs, options);
+
+    switch (alg)
+    {
+    case Algorithm::FIFO:
+        return ScheduleFIFO(procs, options.symbols);
+    case Algorithm::SJF:
+        return ScheduleSJF(procs);
+    case Algorithm::SRT:
+        return ScheduleSRT(procs);
+    case Algorithm::RR:
+        return ScheduleRR(procs, options.quantum);
+    case Algorithm::Priority:
+        return SchedulePriority(procs);
+    case Algorithm::MLFQ:
+        return ScheduleMLFQ(procs, options.mlfqLevels, options.mlfqQuanta, options.mlfqBoost);
+    case Algorithm::CFS:
+        return ScheduleCFS(procs, options.cfsTargetLatency, options.cfsMinGranularity);
+    case Algorithm::PriorityP:
+        return SchedulePreemptivePriority(procs, options.agingInterval, options.agingCap);
+    case Algorithm::EDF:
+        return ScheduleEDF(procs, options.realtimeHorizon);
+    case Algorithm::RM:
+        return ScheduleRM(procs, options.realtimeHorizon);
+    }
+    return ScheduleResult();
+}
+
+std::vector<ScheduleResult> RunSchedulers(const std::vector<Algorithm> &algs,
+                                          const Workload &procs,
+                                          const SchedulerOptions &options)
+{
+    std::vector<ScheduleResult> results(algs.size());
+    ParallelFor(algs.size(), [&](size_t k)
+                { results[k] = RunScheduler(algs[k], procs, options); },
+                options.threads);
+    return results;
+}
+
+std::vector<QuantumSweepPoint> SweepRoundRobin(const Workload &procs,
+                                               int minQuantum, int maxQuantum, int step,
+                                               unsigned threads)
+{
+    std::vector<QuantumSweepPoint> points;
+    minQuantum = std::max(1, minQuantum);
+    step = std::max(1, step);
+    for (int q = minQuantum; q <= maxQuantum; q += step)
+    {
+        QuantumSweepPoint point;
+        point.quantum = q;
+        points.push_back(point);
+    }
+
+    // Cada corrida es independiente; solo se guardan sus metricas
+    ParallelFor(points.size(), [&](size_t k)
+                { points[k].metrics = ScheduleRR(procs, points[k].quantum).metrics; },
+                threads);
+    return points;
+}
+
+const char *AlgorithmName(Algorithm alg)
+{
+    switch (alg)
+    {
+    case Algorithm::FIFO:
+        return "FIFO";
+    case Algorithm::SJF:
+        return "SJF";
+    case Algorithm::SRT:
+        return "SRT";
+    case Algorithm::RR:
+        return "RR";
+    case Algorithm::Priority:
+        return "Priority";
+    case Algorithm::MLFQ:
+        return "MLFQ";
+    case Algorithm::CFS:
+        return "CFS";
+    case Algorithm::PriorityP:
+        return "PriorityP";
+    case Algorithm::EDF:
+        return "EDF";
+    case Algorithm::RM:
+        return "RM";
+    }
+    return "?";
+}
+
+bool ParseAlgorithm(const std::string &name, Algorithm &alg)
+{
+    std::string lower = name;
+    std::transform(lower.begin(), lower.end(), lower.begin(),
+                   [](unsigned char c)
+                   { return static_cast<char>(std::tolower(c)); });
+
+    static const Algorithm todos[] = {Algorithm::FIFO, Algorithm::SJF, Algorithm::SRT,
+                                      Algorithm::RR, Algorithm::Priority, Algorithm::MLFQ,
+                                      Algorithm::CFS, Algorithm::PriorityP, Algorithm::EDF,
+                                      Algorithm::RM};
+    for (Algorithm a : todos)
+    {
+        std::string candidato = AlgorithmName(a);
+        std::transform(candidato.begin(), candidato.end(), candidato.begin(),
+                       [](unsigned char c)
+                       { return static_cast<char>(std::tolower(c)); });
+        if (candidato == lower)
+        {
+            alg = a;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ParseQuantumList(const std::string &text, std::vector<int> &quanta)
+{
+    std::vector<int> valores;
+    size_t inicio = 0;
+    while (inicio <= text.size())
+    {
+        size_t fin = text.find(',', inicio);
+        if (fin == std::string::npos)
+            fin = text.size();
+        std::string campo = text.substr(inicio, fin - inicio);
+        char *resto = nullptr;
+        long valor = std::strtol(campo.c_str(), &resto, 10);
+        while (resto && std::isspace(static_cast<unsigned char>(*resto)))
+            resto++;
+        if (campo.empty() || *resto != '\0' || valor < 1 || valor > INT_MAX)
+            return false;
+        valores.push_back(static_cast<int>(valor));
+        inicio = fin + 1;
+    }
+    quanta = std::move(valores);
+    return true;
+}
@@ -0,0 +1,293 @@
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+// Motor de calendarizacion independiente de wxWidgets.
+// Recibe la carga de trabajo en columnas y devuelve los segmentos de ejecucion
+// y las metricas de cada algoritmo, de modo que pueda usarse sin pantalla.
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "symbols.h"
+
+// Fila de un proceso (PID, Burst Time, Arrival Time, Prioridad[, Periodo]) tal
+// como se lee del archivo. 'pid' es el ID del nombre en la tabla de simbolos.
+// El periodo solo lo usan EDF y RM (0 = proceso sin periodo ni deadline).
+struct SchedProcess
+{
+    int pid = 0;
+    int burstTime = 0;
+    int arrivalTime = 0;
+    int priority = 0;
+    int period = 0;
+};
+
+// Carga de trabajo en columnas: un arreglo por campo en lugar de un struct por
+// proceso (20 bytes por proceso, sin memoria propia por fila). El proceso i es
+// la fila i de todas las columnas.
+struct Workload
+{
+    std::vector<int> pid;
+    std::vector<int> burstTime;
+    std::vector<int> arrivalTime;
+    std::vector<int> priority;
+    std::vector<int> period;
+
+    size_t Size() const { return pid.size(); }
+    bool Empty() const { return pid.empty(); }
+
+    void Clear()
+    {
+        pid.clear();
+        burstTime.clear();
+        arrivalTime.clear();
+        priority.clear();
+        period.clear();
+    }
+
+    void Reserve(size_t n)
+    {
+        pid.reserve(n);
+        burstTime.reserve(n);
+        arrivalTime.reserve(n);
+        priority.reserve(n);
+        period.reserve(n);
+    }
+
+    void Add(const SchedProcess &p)
+    {
+        pid.push_back(p.pid);
+        burstTime.push_back(p.burstTime);
+        arrivalTime.push_back(p.arrivalTime);
+        priority.push_back(p.priority);
+        period.push_back(p.period);
+    }
+};
+
+// Tramo de ejecucion continua de un proceso
+struct ExecSegment
+{
+    int start = 0;  // ciclo de inicio
+    int length = 0; // duracion en ciclos
+};
+
+struct SchedMetrics
+{
+    double avgWaitingTime = 0.0;
+    double avgTurnaroundTime = 0.0;
+    double throughput = 0.0;
+    int makespan = 0;
+    int maxWaitTime = 0;     // la mayor espera continua de cualquier proceso
+    int contextSwitches = 0; // cambios de un proceso a otro distinto en la CPU (en cada CPU)
+    int migrations = 0;      // reanudaciones en un CPU distinto al anterior (solo SMP)
+};
+
+// Resultado de la prueba de utilizacion de EDF y RM
+enum class Schedulability
+{
+    Guaranteed, // U <= cota: ningun trabajo pierde su deadline
+    Unknown,    // cota < U <= 1 (solo RM): la prueba no decide
+    Overloaded  // U > 1: algun trabajo pierde su deadline
+};
+
+// Deadlines de EDF y RM, en el mismo indice que la carga de trabajo. Cada
+// trabajo vence un periodo despues de liberarse; la lateness es fin - deadline
+// (negativa si termino con holgura). Los procesos sin periodo no tienen
+// deadline: cuentan sus trabajos pero no su lateness.
+struct RealTimeStats
+{
+    std::vector<int> jobs;        // trabajos liberados
+    std::vector<int> misses;      // trabajos que terminaron despues de su deadline
+    std::vector<int> maxLateness; // mayor lateness de sus trabajos (0 sin periodo)
+    int totalJobs = 0;
+    int totalMisses = 0;
+    int worstLateness = 0;         // mayor lateness de un trabajo con deadline (0 si no hay)
+    int horizon = 0;               // las liberaciones periodicas ocurren antes de este ciclo
+    double utilization = 0.0;      // suma de burst / periodo de los procesos periodicos
+    double utilizationBound = 0.0; // 1 en EDF; n(2^(1/n) - 1) en RM con n tareas periodicas
+
+    bool Empty() const { return jobs.empty(); }
+
+    // La suma en punto flotante puede pasar de la cota por redondeo (1/3 * 3)
+    Schedulability Verdict() const
+    {
+        const double kTolerancia = 1e-9;
+        if (utilization <= utilizationBound + kTolerancia)
+            return Schedulability::Guaranteed;
+        return utilization <= 1.0 + kTolerancia ? Schedulability::Unknown : Schedulability::Overloaded;
+    }
+};
+
+// Resultado en columnas, en el mismo indice que la carga de trabajo. Los
+// segmentos de todos los procesos comparten un solo arreglo: los del proceso
+// i son segments[segmentOffset[i], segmentOffset[i + 1]), en orden de tiempo.
+struct ScheduleResult
+{
+    std::vector<int> startTime;
+    std::vector<int> finishTime;
+    std::vector<int> waitingTime;
+    std::vector<int> maxWaitTime; // mayor tramo continuo listo sin ejecutar
+    std::vector<size_t> segmentOffset; // Size() + 1 entradas
+    std::vector<ExecSegment> segments;
+    std::vector<int> segmentCpu; // CPU de cada segmento; vacio con un solo CPU
+    int cpus = 1;
+    SchedMetrics metrics;
+    RealTimeStats realtime; // solo EDF y RM
+
+    const ExecSegment *SegmentsBegin(size_t i) const { return segments.data() + segmentOffset[i]; }
+    const ExecSegment *SegmentsEnd(size_t i) const { return segments.data() + segmentOffset[i + 1]; }
+};
+
+enum class Algorithm
+{
+    FIFO,
+    SJF,
+    SRT,
+    RR,
+    Priority,
+    MLFQ,
+    CFS,
+    PriorityP,
+    EDF,
+    RM
+};
+
+// Reparto de la carga entre CPUs en las variantes SMP
+enum class LoadBalance
+{
+    Global,      // una sola cola compartida por todos los CPUs
+    Push,        // una cola por CPU; cada 'balanceInterval' ciclos se mueven
+                 // procesos de la cola mas cargada a la menos cargada
+    WorkStealing // una cola por CPU; un CPU sin trabajo toma el siguiente
+                 // proceso de la cola mas larga
+};
+
+// Mayor numero de CPUs que aceptan la interfaz y el modo sin pantalla
+const int kMaxCpus = 256;
+
+// Mayor numero de niveles de MLFQ (uno por bit del mapa de niveles ocupados)
+constexpr int kMaxMlfqLevels = 64;
+
+struct SchedulerOptions
+{
+    int quantum = 3;      // Solo para Round Robin
+    unsigned threads = 0; // Hilos para ejecuciones en paralelo (0 = todos los nucleos)
+    const SymbolTable *symbols = nullptr; // Nombres de los PID; FIFO desempata por nombre
+
+    int cpus = 1; // mas de 1: variante SMP de cada algoritmo
+    LoadBalance balance = LoadBalance::WorkStealing;
+    int balanceInterval = 4; // ciclos entre rondas de migracion (solo Push)
+
+    // MLFQ: numero de niveles (1 a kMaxMlfqLevels), quantum de cada nivel (los niveles sin
+    // valor duplican el anterior) y ciclos entre cada subida de todos los
+    // procesos al nivel mas alto (0 = nunca)
+    int mlfqLevels = 3;
+    std::vector<int> mlfqQuanta = {2, 4, 8};
+    int mlfqBoost = 50;
+
+    // CFS: latencia objetivo (periodo en que cada proceso listo deberia correr
+    // una vez) y granularidad minima de un turno, en ciclos
+    int cfsTargetLatency = 24;
+    int cfsMinGranularity = 3;
+
+    // Prioridad expropiativa: un proceso listo gana un nivel de prioridad por
+    // cada 'agingInterval' ciclos de espera (0 = sin envejecimiento), sin pasar
+    // de la prioridad 'agingCap'. Los que esperan mucho acaban todos en esa
+    // cubeta y se atienden en orden, asi que ninguno espera indefinidamente.
+    int agingInterval = 5;
+    int agingCap = 0;
+
+    // EDF y RM: las tareas periodicas liberan trabajos antes de este ciclo
+    // (0 = automatico: ultima llegada + hiperperiodo)
+    int realtimeHorizon = 0;
+};
+
+// Algoritmos individuales
+ScheduleResult ScheduleFIFO(const Workload &procs, const SymbolTable *symbols = nullptr);
+ScheduleResult ScheduleSJF(const Workload &procs);
+ScheduleResult ScheduleSRT(const Workload &procs);
+ScheduleResult ScheduleRR(const Workload &procs, int quantum);
+ScheduleResult SchedulePriority(const Workload &procs);
+
+// Multilevel feedback queue: los procesos llegan al nivel 0 (el mas alto);
+// agotar el quantum del nivel los baja uno y cada 'boostInterval' ciclos todos
+// vuelven al nivel 0. Una llegada expropia a un proceso de un nivel inferior.
+// La cola es una FIFO por nivel con un mapa de bits de niveles no vacios, de
+// modo que elegir el siguiente proceso es O(1).
+ScheduleResult ScheduleMLFQ(const Workload &procs, int levels, const std::vector<int> &quanta,
+                            int boostInterval);
+
+// Prioridad expropiativa con envejecimiento. Los listos se guardan en cubetas
+// por prioridad efectiva (FIFO dentro de cada una) y cada envejecimiento es un
+// evento que mueve un proceso a la cubeta siguiente, de modo que subir la
+// prioridad no recorre la cola. El que corre conserva la prioridad ganada y
+// solo lo expropia uno estrictamente mejor; al volver a la cola parte de nuevo
+// de su prioridad original.
+ScheduleResult SchedulePreemptivePriority(const Workload &procs, int agingInterval, int agingCap);
+
+// Completely Fair Scheduler: la prioridad es el nice del proceso (-20 a 19,
+// menor = mas peso; fuera de rango se recorta) y su peso sale de la misma tabla
+// que usa Linux. Cada proceso acumula vruntime = tiempo ejecutado * 1024 / peso
+// y siempre corre el de menor vruntime (arbol ordenado por vruntime). Su turno
+// es su parte, segun el peso, de max(targetLatency, listos * minGranularity),
+// y nunca menos de minGranularity. Un proceso nuevo entra con el vruntime
+// minimo actual y expropia al que corre si este le lleva mas de
+// minGranularity ciclos (escalados a su peso) de vruntime.
+ScheduleResult ScheduleCFS(const Workload &procs, int targetLatency, int minGranularity);
+
+// Tiempo real. Un proceso con periodo P > 0 es una tarea periodica: libera un
+// trabajo de 'burstTime' ciclos en su llegada y luego cada P ciclos mientras
+// la liberacion sea anterior a 'horizon', y cada trabajo vence P ciclos despues
+// de liberarse. Un proceso sin periodo es un solo trabajo sin deadline que
+// solo corre cuando no hay trabajos con deadline listos. Ambos expropian y
+// guardan los listos en un heap: EDF por deadline absoluto y RM por periodo
+// (prioridad fija, menor periodo = mas prioridad). Un trabajo que pierde su
+// deadline sigue hasta terminar. Con horizon <= 0 se usa la ultima llegada
+// periodica mas el hiperperiodo (mcm de los periodos, hasta kMaxAutoHorizon).
+// En un proceso periodico la espera es el promedio por trabajo liberado, el
+// inicio es el de su primer trabajo y el fin el de su ultimo.
+const int kMaxAutoHorizon = 1000000;
+ScheduleResult ScheduleEDF(const Workload &procs, int horizon = 0);
+ScheduleResult ScheduleRM(const Workload &procs, int horizon = 0);
+
+// Variante SMP de 'alg' con options.cpus CPUs. Con colas por CPU cada llegada
+// va a la cola del CPU (orden de llegada modulo CPUs) y el balanceo corrige el
+// desequilibrio. Cada CPU elige de su cola con el criterio del algoritmo; en
+// SRT un proceso mas corto en la cola expropia al de su CPU. Con un CPU da el
+// mismo resultado que el algoritmo de un solo CPU. MLFQ, CFS, la prioridad
+// expropiativa, EDF y RM no tienen variante SMP y se simulan en un solo CPU.
+ScheduleResult ScheduleSMP(Algorithm alg, const Workload &procs, const SchedulerOptions &options);
+
+// Despacha al algoritmo indicado (a su variante SMP si options.cpus > 1)
+ScheduleResult RunScheduler(Algorithm alg, const Workload &procs, const SchedulerOptions &options);
+
+// Ejecuta varios algoritmos en paralelo sobre la misma carga de trabajo.
+// Devuelve un resultado por algoritmo, en el mismo orden que 'algs'.
+std::vector<ScheduleResult> RunSchedulers(const std::vector<Algorithm> &algs,
+                                          const Workload &procs,
+                                          const SchedulerOptions &options);
+
+// Punto de un barrido de quantum de Round Robin
+struct QuantumSweepPoint
+{
+    int quantum = 0;
+    SchedMetrics metrics;
+};
+
+// Ejecuta Round Robin para cada quantum en [minQuantum, maxQuantum] con el paso
+// indicado, repartiendo las corridas entre 'threads' hilos (0 = todos los nucleos).
+// Solo conserva las metricas de cada corrida.
+std::vector<QuantumSweepPoint> SweepRoundRobin(const Workload &procs,
+                                               int minQuantum, int maxQuantum, int step,
+                                               unsigned threads = 0);
+
+// Nombre corto ("FIFO", "SJF", ...) y conversion desde texto (sin distinguir mayusculas)
+const char *AlgorithmName(Algorithm alg);
+bool ParseAlgorithm(const std::string &name, Algorithm &alg);
+
+// Lista de quantum de MLFQ separados por coma ("2,4,8"); false si algun valor
+// no es un entero positivo
+bool ParseQuantumList(const std::string &text, std::vector<int> &quanta);
+
+#endif // SCHEDULER_H
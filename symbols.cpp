@@ -0,0 +1,50 @@
+#include "symbols.h"
+
+SymbolTable::SymbolTable(const SymbolTable &other)
+{
+    *this = other;
+}
+
+SymbolTable &SymbolTable::operator=(const SymbolTable &other)
+{
+    if (this != &other)
+    {
+        // Las claves deben apuntar a los strings propios, no a los de 'other'
+        Clear();
+        for (const auto &name : other.m_names)
+            Intern(name);
+    }
+    return *this;
+}
+
+int SymbolTable::Intern(std::string_view name)
+{
+    auto it = m_ids.find(name);
+    if (it != m_ids.end())
+        return it->second;
+
+    int id = static_cast<int>(m_names.size());
+    m_names.emplace_back(name);
+    m_ids.emplace(m_names.back(), id);
+    return id;
+}
+
+int SymbolTable::Find(std::string_view name) const
+{
+    auto it = m_ids.find(name);
+    return it != m_ids.end() ? it->second : -1;
+}
+
+void SymbolTable::Clear()
+{
+    m_ids.clear();
+    m_names.clear();
+}
+
+std::vector<int> SymbolTable::Merge(const SymbolTable &other)
+{
+    std::vector<int> remap(other.Size());
+    for (size_t i = 0; i < remap.size(); ++i)
+        remap[i] = Intern(other.m_names[i]);
+    return remap;
+}
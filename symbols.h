@@ -0,0 +1,41 @@
+#ifndef SYMBOLS_H
+#define SYMBOLS_H
+
+// Tabla de simbolos: asigna a cada nombre (PID, recurso, accion) un ID entero
+// denso al cargar los archivos. El motor y las vistas trabajan con los IDs y
+// solo consultan el texto para mostrarlo.
+
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+class SymbolTable
+{
+public:
+    SymbolTable() = default;
+    SymbolTable(const SymbolTable &other);
+    SymbolTable &operator=(const SymbolTable &other);
+
+    // Devuelve el ID del nombre, agregandolo si no existia
+    int Intern(std::string_view name);
+
+    // ID del nombre o -1 si no esta en la tabla
+    int Find(std::string_view name) const;
+
+    const std::string &Name(int id) const { return m_names[id]; }
+    size_t Size() const { return m_names.size(); }
+    void Clear();
+
+    // Agrega los nombres de 'other' y devuelve, para cada ID de 'other', su ID
+    // en esta tabla
+    std::vector<int> Merge(const SymbolTable &other);
+
+private:
+    // Las claves apuntan a los strings de m_names; std::deque no los mueve al crecer
+    std::deque<std::string> m_names;
+    std::unordered_map<std::string_view, int> m_ids;
+};
+
+#endif // SYMBOLS_H
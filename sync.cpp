@@ -0,0 +1,752 @@
+#include "sync.h"
+
+#include <algorithm>
+#include <climits>
+#include <deque>
+#include <fstream>
+#include <numeric>
+#include <tuple>
+
+namespace
+{
+    // Mayor ID de simbolo usado como recurso, para dimensionar los contadores
+    int MaxResourceId(const std::vector<SyncResource> &resources, const std::vector<SyncAction> &actions)
+    {
+        int maximo = -1;
+        for (const auto &r : resources)
+            maximo = std::max(maximo, r.name);
+        for (const auto &a : actions)
+            maximo = std::max(maximo, a.resource);
+        return maximo;
+    }
+
+    // Entradas de un bloque con la clave dada (el bloque esta ordenado por clave)
+    SyncIndexRange KeyRange(SyncIndexRange bloque, int key)
+    {
+        auto menor = [](const SyncIndexEntry &e, int k)
+        { return e.key < k; };
+        auto mayor = [](int k, const SyncIndexEntry &e)
+        { return k < e.key; };
+        SyncIndexRange r;
+        r.first = std::lower_bound(bloque.first, bloque.last, key, menor);
+        r.last = std::upper_bound(r.first, bloque.last, key, mayor);
+        return r;
+    }
+
+    // Accion en la cola de espera de un recurso
+    struct Espera
+    {
+        int priority;
+        long long turno; // orden de llegada a la cola
+        int action;
+    };
+
+    bool Despues(const Espera &a, const Espera &b)
+    {
+        return a.priority != b.priority ? a.priority > b.priority : a.turno > b.turno;
+    }
+
+    // Cola de espera: FIFO o por prioridad (heap con el primero al frente).
+    // En FIFO las entradas atendidas se descartan del frente por bloques, asi
+    // que una cola vacia no reserva memoria.
+    class ColaEspera
+    {
+    public:
+        bool Empty() const { return m_inicio == m_items.size(); }
+        const Espera &Front() const { return m_items[m_inicio]; }
+
+        void Push(const Espera &e, bool porPrioridad)
+        {
+            m_items.push_back(e);
+            if (porPrioridad)
+                std::push_heap(m_items.begin(), m_items.end(), Despues);
+        }
+
+        int Pop(bool porPrioridad)
+        {
+            if (porPrioridad)
+            {
+                std::pop_heap(m_items.begin(), m_items.end(), Despues);
+                int a = m_items.back().action;
+                m_items.pop_back();
+                return a;
+            }
+            int a = m_items[m_inicio++].action;
+            if (m_inicio == m_items.size())
+            {
+                m_items.clear();
+                m_inicio = 0;
+            }
+            else if (m_inicio >= 64 && m_inicio * 2 >= m_items.size())
+            {
+                m_items.erase(m_items.begin(), m_items.begin() + m_inicio);
+                m_inicio = 0;
+            }
+            return a;
+        }
+
+    private:
+        std::vector<Espera> m_items;
+        size_t m_inicio = 0; // solo en FIFO; el heap empieza siempre en 0
+    };
+}
+
+double SyncResourceStats::Parallelism() const
+{
+    return busyCycles > 0 ? static_cast<double>(holderCycles) / busyCycles : 0.0;
+}
+
+double SyncResourceStats::Utilization(int horizon) const
+{
+    return horizon > 0 ? std::min(1.0, static_cast<double>(busyCycles) / horizon) : 0.0;
+}
+
+double SyncResourceStats::AvgWait() const
+{
+    return acquisitions > 0 ? static_cast<double>(waitCycles) / acquisitions : 0.0;
+}
+
+void SyncActionIndex::Clear()
+{
+    m_cycles.clear();
+    m_offset.clear();
+    m_byProcess.clear();
+    m_byResource.clear();
+}
+
+void SyncActionIndex::Build(const std::vector<SyncAction> &actions)
+{
+    Clear();
+    const int n = static_cast<int>(actions.size());
+
+    // 1. Orden por (ciclo, PID, recurso); el orden estable conserva el del
+    //    archivo dentro de cada clave
+    std::vector<int> orden(n);
+    std::iota(orden.begin(), orden.end(), 0);
+    std::stable_sort(orden.begin(), orden.end(), [&](int a, int b)
+                     { return std::tie(actions[a].cycle, actions[a].pid, actions[a].resource) <
+                              std::tie(actions[b].cycle, actions[b].pid, actions[b].resource); });
+    m_byProcess.reserve(n);
+    for (int a : orden)
+    {
+        if (m_cycles.empty() || m_cycles.back() != actions[a].cycle)
+        {
+            m_cycles.push_back(actions[a].cycle);
+            m_offset.push_back(m_byProcess.size());
+        }
+        m_byProcess.push_back({actions[a].pid, a});
+    }
+    m_offset.push_back(m_byProcess.size());
+
+    // 2. Mismo bloque por ciclo, ordenado por recurso
+    m_byResource.reserve(n);
+    for (size_t b = 0; b < m_cycles.size(); ++b)
+    {
+        size_t inicio = m_byResource.size();
+        for (size_t k = m_offset[b]; k < m_offset[b + 1]; ++k)
+        {
+            int a = m_byProcess[k].action;
+            m_byResource.push_back({actions[a].resource, a});
+        }
+        std::stable_sort(m_byResource.begin() + inicio, m_byResource.end(),
+                         [&](const SyncIndexEntry &x, const SyncIndexEntry &y)
+                         { return x.key < y.key || (x.key == y.key && x.action < y.action); });
+    }
+}
+
+size_t SyncActionIndex::LowerBucket(int cycle) const
+{
+    return std::lower_bound(m_cycles.begin(), m_cycles.end(), cycle) - m_cycles.begin();
+}
+
+SyncIndexRange SyncActionIndex::ByProcess(size_t bucket) const
+{
+    SyncIndexRange r;
+    r.first = m_byProcess.data() + m_offset[bucket];
+    r.last = m_byProcess.data() + m_offset[bucket + 1];
+    return r;
+}
+
+SyncIndexRange SyncActionIndex::OfProcess(size_t bucket, int pid) const
+{
+    return KeyRange(ByProcess(bucket), pid);
+}
+
+SyncIndexRange SyncActionIndex::ByResource(size_t bucket) const
+{
+    SyncIndexRange r;
+    r.first = m_byResource.data() + m_offset[bucket];
+    r.last = m_byResource.data() + m_offset[bucket + 1];
+    return r;
+}
+
+SyncIndexRange SyncActionIndex::OnResource(size_t bucket, int resource) const
+{
+    return KeyRange(ByResource(bucket), resource);
+}
+
+std::pair<size_t, size_t> SyncTimeline::EventsAt(int cycle) const
+{
+    return EventsBetween(cycle, cycle);
+}
+
+std::pair<size_t, size_t> SyncTimeline::EventsBetween(int firstCycle, int lastCycle) const
+{
+    auto antes = [](const SyncEvent &e, int c)
+    { return e.cycle < c; };
+    auto inicio = std::lower_bound(events.begin(), events.end(), firstCycle, antes);
+    auto fin = std::upper_bound(inicio, events.end(), lastCycle, [](int c, const SyncEvent &e)
+                                { return c < e.cycle; });
+    return {static_cast<size_t>(inicio - events.begin()), static_cast<size_t>(fin - events.begin())};
+}
+
+SyncTimeline SimulateSync(const Workload &procs, const std::vector<SyncResource> &resources,
+                          const std::vector<SyncAction> &actions, const SyncOptions &options)
+{
+    SyncActionIndex index;
+    index.Build(actions);
+    return SimulateSync(procs, resources, actions, index, options);
+}
+
+SyncTimeline SimulateSync(const Workload &procs, const std::vector<SyncResource> &resources,
+                          const std::vector<SyncAction> &actions, const SyncActionIndex &index,
+                          const SyncOptions &options)
+{
+    SyncTimeline t;
+    const int n = static_cast<int>(actions.size());
+    const int retencion = std::max(1, options.holdCycles);
+    t.acquired.assign(n, kSyncNever);
+    t.row.assign(n, -1);
+
+    // 1. Fila de cada PID: la primera del Workload. Un PID repetido no cambia
+    //    nada: sus acciones llegan por la primera fila.
+    int maxPid = -1;
+    for (int pid : procs.pid)
+        maxPid = std::max(maxPid, pid);
+    for (const auto &a : actions)
+        maxPid = std::max(maxPid, a.pid);
+    std::vector<int> filaDePid(maxPid + 1, -1);
+    for (size_t i = procs.Size(); i-- > 0;)
+        filaDePid[procs.pid[i]] = static_cast<int>(i);
+    for (int i = 0; i < n; ++i)
+        t.row[i] = filaDePid[actions[i].pid];
+
+    // 2. Unidades libres por ID de recurso; si un recurso se repite vale el
+    //    ultimo. Un mutex es binario aunque el contador sea mayor; en modo
+    //    lectores/escritores solo importa si hay alguna unidad.
+    const bool rw = (options.mode == SyncMode::ReaderWriter);
+    const size_t recursos = MaxResourceId(resources, actions) + 1;
+    std::vector<int> libres(recursos, 0);
+    for (const auto &r : resources)
+        libres[r.name] = (options.mode == SyncMode::Semaphore) ? r.counter : std::min(r.counter, 1);
+
+    // 3. Las acciones con el mismo (PID, recurso, ciclo) estan juntas en el
+    //    indice y comparten el acceso de la primera; el acceso es de escritura
+    //    si alguna de ellas escribe
+    std::vector<int> keys(n);
+    for (size_t b = 0; b < index.Buckets(); ++b)
+    {
+        const SyncIndexEntry *previa = nullptr;
+        for (const SyncIndexEntry &e : index.ByProcess(b))
+        {
+            bool misma = previa && previa->key == e.key &&
+                         actions[previa->action].resource == actions[e.action].resource;
+            keys[e.action] = misma ? keys[previa->action] : e.action;
+            previa = &e;
+        }
+    }
+    std::vector<int> accesoDeClave(n, kSyncNever);
+    std::vector<char> enCola(n, 0);   // por clave
+    std::vector<char> escribe(n, 0);  // por clave
+    for (int i = 0; i < n; ++i)
+        if (actions[i].action != options.readAction)
+            escribe[keys[i]] = 1;
+
+    // 4. Colas de espera por recurso. En modo lectores/escritores las lecturas
+    //    esperan en 'colasLectura' y las escrituras en 'colas'; el turno es
+    //    comun, asi que se puede saber quien llego primero a cualquiera de las dos.
+    const bool porPrioridad = (options.wakeOrder == SyncWakeOrder::Priority);
+    std::vector<ColaEspera> colas(recursos);
+    std::vector<ColaEspera> colasLectura(rw ? recursos : 0);
+    std::vector<char> escribiendo(rw ? recursos : 0, 0);
+    long long turnos = 0;
+    auto antes = [&](const Espera &a, const Espera &b)
+    { return porPrioridad ? Despues(b, a) : a.turno < b.turno; };
+
+    // Accesos en curso por recurso y ciclo en que cambiaron por ultima vez,
+    // para acumular el uso de cada recurso sin recorrer ciclos; igual con los
+    // accesos en espera de cada proceso. Las esperas mayores que 0 se guardan
+    // para los percentiles y el recurso que mas bloqueo a cada proceso.
+    std::vector<int> activos(recursos, 0);
+    std::vector<int> desde(recursos, 0);
+    std::vector<int> enEspera(recursos, 0);
+    std::vector<int> bloqueadas(procs.Size(), 0);
+    std::vector<int> bloqueoDesde(procs.Size(), 0);
+    struct Muestra
+    {
+        int resource;
+        int row;
+        int wait;
+    };
+    std::vector<Muestra> muestras;
+    t.resources.assign(recursos, SyncResourceStats());
+    t.processes.assign(procs.Size(), SyncProcessStats());
+
+    // Liberaciones pendientes. La retencion es la misma para todas, asi que se
+    // generan ya ordenadas por ciclo.
+    struct Liberacion
+    {
+        int cycle;
+        int resource;
+        bool escritura;
+        int row; // proceso que retiene la unidad
+    };
+    std::deque<Liberacion> liberaciones;
+    int ciclo = 0;
+
+    // Grafo de espera (solo si los procesos retienen mientras esperan): por
+    // recurso, las filas que tienen sus unidades y las que lo esperan; por
+    // fila, los recursos que espera y las liberaciones aplazadas hasta que
+    // deje de esperar
+    const bool retener = options.holdWhileBlocked;
+    std::vector<std::vector<int>> titulares(retener ? recursos : 0);
+    std::vector<std::vector<int>> esperanA(retener ? recursos : 0);
+    std::vector<std::vector<int>> esperasDe(retener ? procs.Size() : 0);
+    std::vector<std::vector<Liberacion>> aplazadas(retener ? procs.Size() : 0);
+    std::vector<char> atascado(retener ? procs.Size() : 0, 0);
+    std::vector<unsigned> visita(retener ? procs.Size() : 0, 0);
+    unsigned busqueda = 0;
+    std::vector<int> alcanzados;
+    bool interbloqueo = false;
+
+    auto quitar = [](std::vector<int> &v, int x)
+    {
+        auto it = std::find(v.begin(), v.end(), x);
+        *it = v.back();
+        v.pop_back();
+    };
+
+    // Recurso por el que la fila sigue atascada: uno que espera y cuyas
+    // unidades estan todas en filas atascadas (-1 si no hay)
+    auto bloqueaA = [&](int fila)
+    {
+        for (int r : esperasDe[fila])
+        {
+            bool todos = !titulares[r].empty();
+            for (size_t k = 0; k < titulares[r].size() && todos; ++k)
+                todos = atascado[titulares[r][k]] != 0;
+            if (todos)
+                return r;
+        }
+        return -1;
+    };
+
+    // Busca un interbloqueo que incluya a 'origen', cuya espera o acceso
+    // acaba de agregar una arista (o cuyo recurso acaba de perder a su
+    // ultimo titular libre). Solo recorre los procesos bloqueados
+    // alcanzables desde 'origen' (recurso esperado -> sus titulares), que
+    // son los unicos de los que depende; el resto del grafo no se toca.
+    auto detectar = [&](int origen)
+    {
+        // 1. Procesos bloqueados alcanzables
+        ++busqueda;
+        alcanzados.assign(1, origen);
+        visita[origen] = busqueda;
+        for (size_t k = 0; k < alcanzados.size(); ++k)
+            for (int r : esperasDe[alcanzados[k]])
+                for (int q : titulares[r])
+                    if (bloqueadas[q] > 0 && visita[q] != busqueda)
+                    {
+                        visita[q] = busqueda;
+                        alcanzados.push_back(q);
+                    }
+
+        // 2. Mayor conjunto en que cada proceso espera un recurso retenido
+        //    solo por procesos del conjunto: se parte de todos y se descartan
+        //    los que no cumplen hasta que no cambia
+        for (int q : alcanzados)
+            atascado[q] = 1;
+        for (bool cambio = true; cambio;)
+        {
+            cambio = false;
+            for (int q : alcanzados)
+                if (atascado[q] && bloqueaA(q) < 0)
+                {
+                    atascado[q] = 0;
+                    cambio = true;
+                }
+        }
+
+        // 3. Si 'origen' quedo atascado, el conjunto nunca se libera
+        if (atascado[origen])
+        {
+            interbloqueo = true;
+            t.deadlock.cycle = ciclo;
+            for (int q : alcanzados)
+                if (atascado[q])
+                {
+                    t.deadlock.rows.push_back(q);
+                    t.deadlock.resources.push_back(bloqueaA(q));
+                }
+        }
+        for (int q : alcanzados)
+            atascado[q] = 0;
+    };
+
+    auto medir = [&](int r, int cambio)
+    {
+        SyncResourceStats &s = t.resources[r];
+        if (activos[r] > 0)
+        {
+            s.busyCycles += ciclo - desde[r];
+            s.holderCycles += static_cast<long long>(activos[r]) * (ciclo - desde[r]);
+        }
+        desde[r] = ciclo;
+        activos[r] += cambio;
+        s.maxHolders = std::max(s.maxHolders, activos[r]);
+    };
+    auto obtener = [&](int a)
+    {
+        int r = actions[a].resource;
+        bool escritura = escribe[keys[a]] != 0;
+        if (rw)
+            escribiendo[r] = escritura;
+        else
+            libres[r]--;
+        medir(r, 1);
+
+        int fila = t.row[a];
+        int espera = ciclo - std::max(0, actions[a].cycle);
+        SyncResourceStats &s = t.resources[r];
+        SyncProcessStats &p = t.processes[fila];
+        s.acquisitions++;
+        s.waitCycles += espera;
+        p.accesses++;
+        p.maxWait = std::max(p.maxWait, espera);
+        if (enCola[keys[a]])
+        {
+            enEspera[r]--;
+            if (--bloqueadas[fila] == 0)
+                p.blockedCycles += ciclo - bloqueoDesde[fila];
+            muestras.push_back({r, fila, espera});
+            if (retener)
+            {
+                quitar(esperasDe[fila], r);
+                quitar(esperanA[r], fila);
+            }
+        }
+        accesoDeClave[keys[a]] = ciclo;
+        if (ciclo <= INT_MAX - retencion) // si no, vence despues del ultimo ciclo representable
+            liberaciones.push_back({ciclo + retencion, r, escritura, fila});
+        t.events.push_back({ciclo, a, r, SyncEventType::Acquire});
+
+        if (retener)
+        {
+            titulares[r].push_back(fila);
+            if (bloqueadas[fila] > 0)
+            {
+                detectar(fila); // un proceso bloqueado retiene algo mas
+            }
+            else
+            {
+                // Dejo de esperar: lo aplazado se libera en este mismo ciclo
+                // (al frente de la cola, que sigue ordenada por ciclo)
+                for (auto it = aplazadas[fila].rbegin(); it != aplazadas[fila].rend(); ++it)
+                {
+                    Liberacion l = *it;
+                    l.cycle = ciclo;
+                    liberaciones.push_front(l);
+                }
+                aplazadas[fila].clear();
+            }
+        }
+    };
+    auto esperar = [&](int a)
+    {
+        int r = actions[a].resource;
+        int fila = t.row[a];
+        enCola[keys[a]] = 1;
+        SyncResourceStats &s = t.resources[r];
+        s.waits++;
+        s.maxQueue = std::max(s.maxQueue, ++enEspera[r]);
+        t.processes[fila].waits++;
+        if (bloqueadas[fila]++ == 0)
+            bloqueoDesde[fila] = ciclo;
+        ColaEspera &cola = (rw && !escribe[keys[a]]) ? colasLectura[r] : colas[r];
+        cola.Push({procs.priority[t.row[a]], turnos++, a}, porPrioridad);
+        t.events.push_back({ciclo, a, r, SyncEventType::Wait});
+        if (retener)
+        {
+            esperasDe[fila].push_back(r);
+            esperanA[r].push_back(fila);
+            detectar(fila);
+        }
+    };
+
+    // Si una accion que llega puede entrar sin esperar
+    auto puedeEntrar = [&](int r, bool escritura)
+    {
+        if (!rw)
+            return libres[r] > 0 && colas[r].Empty();
+        if (libres[r] <= 0 || escribiendo[r])
+            return false;
+        if (escritura)
+            return activos[r] == 0 && colas[r].Empty() && colasLectura[r].Empty();
+        switch (options.rwPolicy)
+        {
+        case SyncRwPolicy::ReaderPreferring:
+            return true; // los lectores solo esperan mientras alguien escribe
+        case SyncRwPolicy::WriterPreferring:
+            return colas[r].Empty();
+        case SyncRwPolicy::Fair:
+            break;
+        }
+        return colas[r].Empty() && colasLectura[r].Empty();
+    };
+
+    // Lectores/escritores: tras una liberacion concede todos los accesos que
+    // la politica permite con el estado actual del recurso
+    auto repartir = [&](int r)
+    {
+        ColaEspera &lectores = colasLectura[r];
+        ColaEspera &escritores = colas[r];
+        if (libres[r] <= 0)
+            return;
+        switch (options.rwPolicy)
+        {
+        case SyncRwPolicy::ReaderPreferring:
+            while (!escribiendo[r] && !lectores.Empty())
+                obtener(lectores.Pop(porPrioridad));
+            if (activos[r] == 0 && !escritores.Empty())
+                obtener(escritores.Pop(porPrioridad));
+            break;
+        case SyncRwPolicy::WriterPreferring:
+            if (activos[r] == 0 && !escritores.Empty())
+                obtener(escritores.Pop(porPrioridad));
+            while (!escribiendo[r] && escritores.Empty() && !lectores.Empty())
+                obtener(lectores.Pop(porPrioridad));
+            break;
+        case SyncRwPolicy::Fair:
+            // Se atiende el frente comun de las dos colas hasta el primero
+            // que no puede entrar
+            while (!lectores.Empty() || !escritores.Empty())
+            {
+                bool lector = !lectores.Empty() &&
+                              (escritores.Empty() || antes(lectores.Front(), escritores.Front()));
+                if (lector && !escribiendo[r])
+                    obtener(lectores.Pop(porPrioridad));
+                else if (!lector && activos[r] == 0)
+                    obtener(escritores.Pop(porPrioridad));
+                else
+                    break;
+            }
+            break;
+        }
+    };
+
+    // Ciclo en que llega el bloque b: los ciclos negativos llegan en el 0
+    auto llegada = [&](size_t b)
+    { return std::max(0, index.Cycle(b)); };
+    size_t siguienteBloque = 0;
+    std::vector<std::pair<int, int>> llegadas; // (fila, accion)
+
+    // 5. Solo se visitan los ciclos con liberaciones o llegadas; la
+    //    simulacion se detiene al encontrar un interbloqueo
+    while (!interbloqueo)
+    {
+        // 5a. Cada unidad devuelta despierta a la primera accion en espera (o,
+        //     en lectores/escritores, a todas las que la politica deje pasar).
+        //     Si el proceso que la retiene esta esperando, se aplaza.
+        while (!interbloqueo && !liberaciones.empty() && liberaciones.front().cycle == ciclo)
+        {
+            Liberacion l = liberaciones.front();
+            int r = l.resource;
+            liberaciones.pop_front();
+            if (retener)
+            {
+                if (bloqueadas[l.row] > 0)
+                {
+                    aplazadas[l.row].push_back(l);
+                    continue;
+                }
+                quitar(titulares[r], l.row);
+            }
+            if (rw)
+                escribiendo[r] = escribiendo[r] && !l.escritura;
+            else
+                libres[r]++;
+            medir(r, -1);
+            t.finishCycle = ciclo;
+            t.events.push_back({ciclo, -1, r, SyncEventType::Release});
+            if (rw)
+                repartir(r);
+            else if (libres[r] > 0 && !colas[r].Empty())
+                obtener(colas[r].Pop(porPrioridad));
+
+            // Si ya solo lo retienen procesos bloqueados, quienes lo siguen
+            // esperando pueden haber quedado en un interbloqueo sin que se
+            // agregara ninguna arista (en lectores/escritores, un escritor
+            // que espera a que salga el ultimo lector libre)
+            if (retener && !interbloqueo && !esperanA[r].empty() &&
+                std::all_of(titulares[r].begin(), titulares[r].end(), [&](int q)
+                            { return bloqueadas[q] > 0; }))
+            {
+                for (size_t k = 0; k < esperanA[r].size() && !interbloqueo; ++k)
+                    detectar(esperanA[r][k]);
+            }
+        }
+
+        // 5b. Llegadas del ciclo, por fila y luego por orden de archivo
+        llegadas.clear();
+        for (; siguienteBloque < index.Buckets() && llegada(siguienteBloque) == ciclo; ++siguienteBloque)
+            for (const SyncIndexEntry &e : index.ByProcess(siguienteBloque))
+                if (t.row[e.action] >= 0) // PID sin proceso cargado: no se simula
+                    llegadas.push_back({t.row[e.action], e.action});
+        std::sort(llegadas.begin(), llegadas.end());
+
+        for (const auto &l : llegadas)
+        {
+            if (interbloqueo)
+                break;
+            int a = l.second;
+            int r = actions[a].resource;
+            t.events.push_back({ciclo, a, r, SyncEventType::Arrive});
+            if (accesoDeClave[keys[a]] != kSyncNever || enCola[keys[a]])
+                continue; // otra accion con la misma clave ya obtuvo o espera el acceso
+            if (puedeEntrar(r, escribe[keys[a]] != 0))
+                obtener(a);
+            else
+                esperar(a);
+        }
+
+        // 5c. Siguiente ciclo con cambios
+        if (interbloqueo)
+            break;
+        int siguiente = INT_MAX;
+        if (!liberaciones.empty())
+            siguiente = liberaciones.front().cycle;
+        if (siguienteBloque < index.Buckets())
+            siguiente = std::min(siguiente, llegada(siguienteBloque));
+        if (siguiente == INT_MAX)
+            break;
+        ciclo = siguiente;
+    }
+
+    // 6. Accesos que nunca se concedieron; su proceso queda bloqueado (y lo
+    //    que retiene, ocupado) hasta el ultimo evento
+    const int ultimoEvento = t.events.empty() ? 0 : t.events.back().cycle;
+    for (int i = 0; i < n; ++i)
+    {
+        if (keys[i] == i && enCola[i] && accesoDeClave[i] == kSyncNever)
+        {
+            t.resources[actions[i].resource].starved++;
+            t.processes[t.row[i]].starved++;
+        }
+    }
+    for (size_t fila = 0; fila < bloqueadas.size(); ++fila)
+        if (bloqueadas[fila] > 0)
+            t.processes[fila].blockedCycles += ultimoEvento - bloqueoDesde[fila];
+
+    // Recursos que siguen retenidos (por un interbloqueo o por procesos que
+    // nunca dejaron de esperar): quedan ocupados hasta el ultimo evento
+    bool retenidos = false;
+    for (size_t r = 0; r < recursos; ++r)
+    {
+        if (activos[r] > 0)
+        {
+            SyncResourceStats &s = t.resources[r];
+            s.busyCycles += ultimoEvento - desde[r];
+            s.holderCycles += static_cast<long long>(activos[r]) * (ultimoEvento - desde[r]);
+            retenidos = true;
+        }
+    }
+    if (retenidos)
+        t.finishCycle = std::max(t.finishCycle, ultimoEvento);
+
+    // 7. Percentil 99 (por rango) de la espera de cada recurso: los accesos
+    //    que no esperaron cuentan como 0 y no estan en las muestras
+    std::sort(muestras.begin(), muestras.end(), [](const Muestra &x, const Muestra &y)
+              { return x.resource != y.resource ? x.resource < y.resource : x.wait < y.wait; });
+    for (size_t k = 0; k < muestras.size();)
+    {
+        size_t fin = k;
+        while (fin < muestras.size() && muestras[fin].resource == muestras[k].resource)
+            fin++;
+        SyncResourceStats &s = t.resources[muestras[k].resource];
+        long long ceros = s.acquisitions - static_cast<long long>(fin - k);
+        long long rango = (99LL * s.acquisitions + 99) / 100; // 1..acquisitions
+        s.p99Wait = rango <= ceros ? 0 : muestras[k + (rango - ceros) - 1].wait;
+        k = fin;
+    }
+
+    // 8. Recurso con mas ciclos de espera de cada proceso
+    std::sort(muestras.begin(), muestras.end(), [](const Muestra &x, const Muestra &y)
+              { return x.row != y.row ? x.row < y.row : x.resource < y.resource; });
+    for (size_t k = 0; k < muestras.size();)
+    {
+        long long total = 0;
+        size_t fin = k;
+        for (; fin < muestras.size() && muestras[fin].row == muestras[k].row &&
+               muestras[fin].resource == muestras[k].resource;
+             ++fin)
+            total += muestras[fin].wait;
+        SyncProcessStats &p = t.processes[muestras[k].row];
+        if (total > p.worstResourceCycles)
+        {
+            p.worstResource = muestras[k].resource;
+            p.worstResourceCycles = total;
+        }
+        k = fin;
+    }
+
+    // 9. Se muestra hasta 6 ciclos despues de la ultima accion o evento,
+    //    o, si hubo un interbloqueo, hasta el ciclo en que se detecto
+    long long ultimo = std::max(std::max(0, index.MaxCycle()), ultimoEvento);
+    t.lastCycle = interbloqueo ? t.deadlock.cycle : static_cast<int>(std::min<long long>(ultimo + 6, INT_MAX));
+
+    for (int i = 0; i < n; ++i)
+        t.acquired[i] = accesoDeClave[keys[i]];
+    return t;
+}
+
+bool SaveSyncMetrics(const std::string &filename, const SymbolTable &symbols, const Workload &procs,
+                     const std::vector<SyncResource> &resources, const SyncTimeline &timeline)
+{
+    std::ofstream file(filename, std::ios::trunc);
+    if (!file.is_open())
+        return false;
+
+    // 1. Recursos cargados, cada uno una sola vez
+    file << "Recurso,Accesos,Utilizacion,Paralelismo,Espera promedio,Espera p99,"
+            "Esperas,Sin acceso,Cola maxima\n";
+    std::vector<char> visto(timeline.resources.size(), 0);
+    for (const auto &r : resources)
+    {
+        if (static_cast<size_t>(r.name) >= visto.size() || visto[r.name])
+            continue;
+        visto[r.name] = 1;
+        const SyncResourceStats &s = timeline.resources[r.name];
+        file << symbols.Name(r.name) << ',' << s.acquisitions << ','
+             << s.Utilization(timeline.finishCycle) << ',' << s.Parallelism() << ','
+             << s.AvgWait() << ',' << s.p99Wait << ',' << s.waits << ','
+             << s.starved << ',' << s.maxQueue << '\n';
+    }
+
+    // 2. Procesos: solo la primera fila de cada PID
+    file << "\nPID,Accesos,Esperas,Sin acceso,Ciclos bloqueado,Espera maxima,"
+            "Recurso principal,Espera en recurso principal\n";
+    std::vector<char> pidVisto(symbols.Size(), 0);
+    for (size_t fila = 0; fila < procs.Size() && fila < timeline.processes.size(); ++fila)
+    {
+        int pid = procs.pid[fila];
+        if (static_cast<size_t>(pid) >= pidVisto.size() || pidVisto[pid])
+            continue;
+        pidVisto[pid] = 1;
+        const SyncProcessStats &p = timeline.processes[fila];
+        file << symbols.Name(pid) << ',' << p.accesses << ',' << p.waits << ','
+             << p.starved << ',' << p.blockedCycles << ',' << p.maxWait << ','
+             << (p.worstResource >= 0 ? symbols.Name(p.worstResource) : std::string()) << ','
+             << p.worstResourceCycles << '\n';
+    }
+    return static_cast<bool>(file);
+}
@@ -0,0 +1,235 @@
+#ifndef SYNC_H
+#define SYNC_H
+
+// Motor de sincronizacion independiente de wxWidgets. Simula de una sola vez
+// la linea de tiempo de las acciones sobre los recursos y la guarda en
+// arreglos compactos; la vista solo consulta el resultado del ciclo que
+// muestra, de modo que lo que se ve no depende de cuantas veces se redibuje.
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "workload.h"
+
+enum class SyncMode
+{
+    Mutex,       // cerrojo binario: una sola unidad aunque el contador sea mayor
+    Semaphore,   // tantas unidades como indique el contador
+    ReaderWriter // lectores/escritores: las lecturas comparten el recurso y cada
+                 // escritura lo ocupa sola; el contador solo indica si esta
+                 // disponible (> 0)
+};
+
+// Politica del modo lectores/escritores cuando hay lectores y escritores en espera
+enum class SyncRwPolicy
+{
+    ReaderPreferring, // un lector entra mientras nadie escriba, aunque esperen escritores
+    WriterPreferring, // un escritor en espera bloquea a los lectores que llegan despues
+    Fair              // la cola se atiende en orden; los lectores seguidos entran juntos
+};
+
+// Orden en que se despiertan las acciones que esperan un recurso
+enum class SyncWakeOrder
+{
+    Fifo,    // por orden de llegada a la cola
+    Priority // por prioridad del proceso (menor valor primero), luego llegada
+};
+
+struct SyncOptions
+{
+    SyncMode mode = SyncMode::Mutex;
+    SyncWakeOrder wakeOrder = SyncWakeOrder::Fifo;
+    int holdCycles = 1; // ciclos que se retiene cada unidad obtenida (minimo 1)
+    SyncRwPolicy rwPolicy = SyncRwPolicy::Fair;
+    int readAction = -1; // ID de la accion de lectura (READ); las demas escriben
+
+    // Un proceso con algun acceso en espera no devuelve lo que ya obtuvo: sus
+    // unidades vencidas se liberan cuando deja de esperar. Asi las acciones
+    // sobre varios recursos pueden interbloquearse, y se detecta.
+    bool holdWhileBlocked = false;
+};
+
+// Ciclo de acceso de una accion que nunca obtuvo su recurso
+const int kSyncNever = -1;
+
+// Uso y contencion de un recurso durante la simulacion
+struct SyncResourceStats
+{
+    int acquisitions = 0;       // accesos concedidos
+    int maxHolders = 0;         // mayor numero de accesos simultaneos
+    long long busyCycles = 0;   // ciclos con al menos un acceso en curso
+    long long holderCycles = 0; // suma, ciclo a ciclo, de los accesos en curso
+
+    int waits = 0;             // accesos que entraron a la cola (obtenidos o no)
+    int starved = 0;           // accesos que nunca obtuvieron el recurso
+    int maxQueue = 0;          // mayor longitud de la cola de espera
+    long long waitCycles = 0;  // suma de las esperas de los accesos concedidos
+    int p99Wait = 0;           // percentil 99 de la espera de los accesos concedidos
+
+    // Accesos simultaneos en promedio mientras el recurso estuvo ocupado
+    // (1 = sin paralelismo; 0 si nunca se uso)
+    double Parallelism() const;
+
+    // Fraccion de los primeros 'horizon' ciclos con el recurso ocupado
+    double Utilization(int horizon) const;
+
+    // Espera promedio de los accesos concedidos (los que no esperaron cuentan 0)
+    double AvgWait() const;
+};
+
+// Interbloqueo detectado; la simulacion se detiene en 'cycle'
+struct SyncDeadlock
+{
+    int cycle = kSyncNever;     // kSyncNever si no hubo
+    std::vector<int> rows;      // procesos (fila del Workload) que nunca dejaran de esperar
+    std::vector<int> resources; // por cada fila, el recurso retenido por el grupo que espera
+
+    bool Found() const { return cycle != kSyncNever; }
+};
+
+// Bloqueo de un proceso durante la simulacion
+struct SyncProcessStats
+{
+    int accesses = 0;           // accesos concedidos
+    int waits = 0;              // accesos que tuvieron que esperar
+    int starved = 0;            // accesos que nunca obtuvieron su recurso
+    long long blockedCycles = 0; // ciclos con al menos un acceso en espera
+    int maxWait = 0;
+    int worstResource = -1;      // recurso donde acumulo mas espera (-1 si no espero)
+    long long worstResourceCycles = 0;
+};
+
+enum class SyncEventType : uint8_t
+{
+    Arrive,  // la accion llega a su ciclo y empieza a mostrarse
+    Wait,    // no hay unidades libres: la accion entra a la cola del recurso
+    Acquire, // la accion obtiene una unidad del recurso
+    Release  // se devuelve una unidad del recurso
+};
+
+struct SyncEvent
+{
+    int cycle;
+    int action; // indice en el arreglo de acciones
+    int resource;
+    SyncEventType type;
+};
+
+struct SyncTimeline
+{
+    int lastCycle = 0; // ultimo ciclo a mostrar: 6 despues del ultimo evento o accion
+
+    // Eventos ordenados por ciclo; dentro de un ciclo: liberaciones (cada una
+    // seguida de los accesos que despierta) y luego llegadas, en el orden en
+    // que ocurrieron
+    std::vector<SyncEvent> events;
+
+    // Por accion: ciclo en que obtuvo el recurso o kSyncNever. Las acciones con
+    // el mismo PID, recurso y ciclo comparten el acceso de la primera.
+    std::vector<int> acquired;
+
+    // Por accion: fila del proceso (primer indice del Workload con su PID) o
+    // -1 si el PID no esta cargado; esas acciones no se simulan
+    std::vector<int> row;
+
+    // Por ID de recurso: uso y contencion durante la simulacion
+    std::vector<SyncResourceStats> resources;
+
+    // Por fila del Workload (solo la primera fila de cada PID tiene datos)
+    std::vector<SyncProcessStats> processes;
+
+    // Ciclo de la ultima liberacion (0 si no hubo accesos): lo que tarda la
+    // carga completa con el mecanismo elegido. Si la simulacion termina con
+    // recursos retenidos (interbloqueo), al menos el ultimo evento.
+    int finishCycle = 0;
+
+    // Solo con 'holdWhileBlocked'
+    SyncDeadlock deadlock;
+
+    // Eventos del ciclo 'cycle' como rango [first, last) de 'events'
+    std::pair<size_t, size_t> EventsAt(int cycle) const;
+    std::pair<size_t, size_t> EventsBetween(int firstCycle, int lastCycle) const;
+};
+
+// Entrada de un indice de acciones: la clave (PID o recurso) y la accion
+struct SyncIndexEntry
+{
+    int key;
+    int action; // indice en el arreglo de acciones
+};
+
+// Rango [first, last) de entradas del indice
+struct SyncIndexRange
+{
+    const SyncIndexEntry *first = nullptr;
+    const SyncIndexEntry *last = nullptr;
+
+    const SyncIndexEntry *begin() const { return first; }
+    const SyncIndexEntry *end() const { return last; }
+    bool empty() const { return first == last; }
+};
+
+// Indice de acciones por ciclo, construido al cargar el archivo. Solo los
+// ciclos con acciones tienen un bloque (CSR comprimido): el bloque b es el
+// ciclo Cycle(b) y sus acciones estan en dos ordenes, por (PID, recurso) y
+// por recurso, conservando el orden del archivo dentro de cada clave. Asi cada
+// ciclo simulado solo toca sus propias acciones.
+class SyncActionIndex
+{
+public:
+    void Build(const std::vector<SyncAction> &actions);
+    void Clear();
+
+    bool Empty() const { return m_cycles.empty(); }
+    size_t Buckets() const { return m_cycles.size(); }
+    int Cycle(size_t bucket) const { return m_cycles[bucket]; }
+    int MinCycle() const { return m_cycles.empty() ? 0 : m_cycles.front(); }
+    int MaxCycle() const { return m_cycles.empty() ? 0 : m_cycles.back(); }
+
+    // Primer bloque con ciclo >= 'cycle' (Buckets() si no hay)
+    size_t LowerBucket(int cycle) const;
+
+    // Acciones del bloque ordenadas por (PID, recurso); clave = PID
+    SyncIndexRange ByProcess(size_t bucket) const;
+    SyncIndexRange OfProcess(size_t bucket, int pid) const;
+
+    // Acciones del bloque ordenadas por recurso; clave = recurso
+    SyncIndexRange ByResource(size_t bucket) const;
+    SyncIndexRange OnResource(size_t bucket, int resource) const;
+
+private:
+    std::vector<int> m_cycles;     // ciclos distintos, ascendentes
+    std::vector<size_t> m_offset;  // bloque b: [m_offset[b], m_offset[b + 1])
+    std::vector<SyncIndexEntry> m_byProcess;
+    std::vector<SyncIndexEntry> m_byResource;
+};
+
+// Simula la carga completa, desde el ciclo 0 hasta que no quedan llegadas ni
+// liberaciones pendientes. Cada recurso tiene sus unidades (el contador del
+// archivo, o 1 como maximo en modo Mutex; 0 si no se cargo) y una cola de
+// espera. En cada ciclo:
+//   1. vencen las unidades obtenidas hace 'holdCycles' ciclos; cada unidad
+//      devuelta pasa de inmediato a la primera accion de la cola
+//   2. llegan las acciones del ciclo, por proceso en el orden del Workload y
+//      luego en el del archivo: obtienen una unidad si hay libre y nadie
+//      espera; si no, entran a la cola
+// En modo lectores/escritores las lecturas y escrituras esperan en colas
+// separadas y cada liberacion concede todos los accesos compatibles que
+// permita 'rwPolicy'. Las acciones con ciclo negativo llegan en el ciclo 0.
+// Las acciones con el mismo PID, recurso y ciclo comparten un solo acceso,
+// que es de escritura si alguna de ellas escribe.
+// 'index' debe estar construido sobre 'actions'; la segunda forma lo construye.
+SyncTimeline SimulateSync(const Workload &procs, const std::vector<SyncResource> &resources,
+                          const std::vector<SyncAction> &actions, const SyncActionIndex &index,
+                          const SyncOptions &options);
+SyncTimeline SimulateSync(const Workload &procs, const std::vector<SyncResource> &resources,
+                          const std::vector<SyncAction> &actions, const SyncOptions &options);
+
+// Escribe en CSV las metricas de 'timeline': una seccion por recurso cargado
+// y otra por proceso. Devuelve false si no se pudo escribir.
+bool SaveSyncMetrics(const std::string &filename, const SymbolTable &symbols, const Workload &procs,
+                     const std::vector<SyncResource> &resources, const SyncTimeline &timeline);
+
+#endif // SYNC_H
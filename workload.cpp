@@ -0,0 +1,332 @@
+#include "workload.h"
+
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <iterator>
+#include <string_view>
+
+#include "mapped_file.h"
+#include "parallel.h"
+#include "workload_binary.h"
+
+namespace
+{
+    enum class FieldError
+    {
+        None,
+        Invalid,
+        OutOfRange
+    };
+
+    bool IsSpace(char c)
+    {
+        return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+    }
+
+    // Eliminar espacios al inicio y al final (sin copiar)
+    std::string_view Trim(std::string_view s)
+    {
+        size_t inicio = 0;
+        while (inicio < s.size() && IsSpace(s[inicio]))
+            inicio++;
+        size_t fin = s.size();
+        while (fin > inicio && IsSpace(s[fin - 1]))
+            fin--;
+        return s.substr(inicio, fin - inicio);
+    }
+
+    // Divide la linea en a lo sumo 'maxFields' campos separados por coma, ya
+    // recortados. Los campos sobrantes se ignoran. Devuelve cuantos se leyeron.
+    size_t SplitFields(std::string_view line, std::string_view *fields, size_t maxFields)
+    {
+        size_t count = 0;
+        size_t inicio = 0;
+        while (count < maxFields)
+        {
+            size_t coma = line.find(',', inicio);
+            if (coma == std::string_view::npos)
+            {
+                fields[count++] = Trim(line.substr(inicio));
+                break;
+            }
+            fields[count++] = Trim(line.substr(inicio, coma - inicio));
+            inicio = coma + 1;
+        }
+        return count;
+    }
+
+    // Entero decimal con signo opcional; todo el campo debe ser numerico
+    FieldError ParseInt(std::string_view s, int &value)
+    {
+        size_t i = 0;
+        bool negativo = false;
+        if (i < s.size() && (s[i] == '-' || s[i] == '+'))
+        {
+            negativo = (s[i] == '-');
+            i++;
+        }
+        if (i == s.size())
+            return FieldError::Invalid;
+
+        long long acumulado = 0;
+        for (; i < s.size(); ++i)
+        {
+            unsigned digito = static_cast<unsigned>(s[i] - '0');
+            if (digito > 9)
+                return FieldError::Invalid;
+            acumulado = acumulado * 10 + digito;
+            if (acumulado > static_cast<long long>(INT_MAX) + 1)
+                return FieldError::OutOfRange;
+        }
+        if (negativo)
+            acumulado = -acumulado;
+        if (acumulado > INT_MAX || acumulado < INT_MIN)
+            return FieldError::OutOfRange;
+        value = static_cast<int>(acumulado);
+        return FieldError::None;
+    }
+
+    // Bloques de al menos este tamano; por debajo no compensa lanzar hilos
+    const size_t kMinChunkBytes = size_t(4) << 20;
+
+    struct LineWarning
+    {
+        size_t line; // numero de linea dentro del bloque (desde 0)
+        FieldError error;
+        std::string text;
+    };
+
+    template <typename T>
+    struct ChunkResult
+    {
+        std::vector<T> rows;
+        std::vector<LineWarning> warnings;
+        SymbolTable symbols; // nombres del bloque; sus IDs son locales
+        size_t lines = 0;
+    };
+
+    // Pasan los IDs de una fila de la tabla de un bloque a la tabla final
+    void RemapIds(SchedProcess &p, const std::vector<int> &ids)
+    {
+        p.pid = ids[p.pid];
+    }
+
+    void RemapIds(SyncResource &r, const std::vector<int> &ids)
+    {
+        r.name = ids[r.name];
+    }
+
+    void RemapIds(SyncAction &a, const std::vector<int> &ids)
+    {
+        a.pid = ids[a.pid];
+        a.action = ids[a.action];
+        a.resource = ids[a.resource];
+    }
+
+    // Destino de las filas: un vector de structs o la carga de trabajo en columnas
+    template <typename T>
+    void ClearRows(std::vector<T> &out) { out.clear(); }
+    void ClearRows(Workload &out) { out.Clear(); }
+
+    template <typename T>
+    void AppendRows(std::vector<T> &out, std::vector<T> &rows)
+    {
+        std::move(rows.begin(), rows.end(), std::back_inserter(out));
+    }
+
+    void AppendRows(Workload &out, const std::vector<SchedProcess> &rows)
+    {
+        for (const auto &p : rows)
+            out.Add(p);
+    }
+
+    template <typename T>
+    void ReserveRows(std::vector<T> &out, size_t n) { out.reserve(n); }
+    void ReserveRows(Workload &out, size_t n) { out.Reserve(n); }
+
+    // Recorre las lineas no vacias de [p, end); parse(linea, simbolos, fila)
+    // devuelve el error de la linea y solo las filas validas se agregan al bloque.
+    template <typename T, typename Fn>
+    void ParseChunk(const char *p, const char *end, Fn parse, ChunkResult<T> &chunk)
+    {
+        while (p < end)
+        {
+            const char *nl = static_cast<const char *>(std::memchr(p, '\n', end - p));
+            const char *lineEnd = nl ? nl : end;
+            std::string_view line = Trim(std::string_view(p, lineEnd - p));
+            p = nl ? nl + 1 : end;
+            size_t numero = chunk.lines++;
+
+            if (line.empty())
+                continue; // saltar líneas en blanco
+
+            T row;
+            FieldError error = parse(line, chunk.symbols, row);
+            if (error == FieldError::None)
+                chunk.rows.push_back(std::move(row));
+            else
+                chunk.warnings.push_back({numero, error, std::string(line)});
+        }
+    }
+
+    // Divide el archivo en bloques que terminan en un salto de linea, los
+    // analiza en paralelo y une los resultados en el orden del archivo. Cada
+    // bloque interna sus nombres en su propia tabla y al final se traducen a
+    // 'symbols', de modo que los IDs nuevos siguen el orden de aparicion.
+    template <typename T, typename Out, typename Fn>
+    void ParseText(const char *data, size_t size, SymbolTable &symbols, Out &out,
+                   std::vector<std::string> &warnings, unsigned threads, Fn parse)
+    {
+        // 1. Cortes: repartir en varios bloques por hilo y mover cada corte
+        //    hasta despues del siguiente '\n' para no partir lineas
+        size_t bloques = std::min<size_t>(size_t(WorkerCount(threads)) * 4,
+                                          std::max<size_t>(1, size / kMinChunkBytes));
+        std::vector<size_t> cortes{0};
+        for (size_t k = 1; k < bloques; ++k)
+        {
+            size_t corte = std::max(size * k / bloques, cortes.back());
+            const void *nl = std::memchr(data + corte, '\n', size - corte);
+            corte = nl ? static_cast<const char *>(nl) - data + 1 : size;
+            if (corte > cortes.back() && corte < size)
+                cortes.push_back(corte);
+        }
+        cortes.push_back(size);
+
+        // 2. Analizar cada bloque por separado
+        std::vector<ChunkResult<T>> chunks(cortes.size() - 1);
+        ParallelFor(chunks.size(), [&](size_t k)
+                    { ParseChunk(data + cortes[k], data + cortes[k + 1], parse, chunks[k]); },
+                    threads);
+
+        // 3. Traducir los IDs locales (la union de tablas es secuencial, pero
+        //    solo recorre nombres distintos)
+        std::vector<std::vector<int>> ids(chunks.size());
+        for (size_t k = 0; k < chunks.size(); ++k)
+            ids[k] = symbols.Merge(chunks[k].symbols);
+        ParallelFor(chunks.size(), [&](size_t k)
+                    {
+            for (T &row : chunks[k].rows)
+                RemapIds(row, ids[k]); },
+                    threads);
+
+        // 4. Unir en orden; los numeros de linea pasan a ser del archivo
+        size_t total = 0;
+        for (const auto &chunk : chunks)
+            total += chunk.rows.size();
+        ReserveRows(out, total);
+
+        size_t primeraLinea = 1;
+        for (auto &chunk : chunks)
+        {
+            AppendRows(out, chunk.rows);
+            for (const auto &w : chunk.warnings)
+            {
+                std::string numero = std::to_string(primeraLinea + w.line);
+                if (w.error == FieldError::OutOfRange)
+                    warnings.push_back("Línea " + numero + ": valor fuera de rango \"" + w.text + "\". Se omite.");
+                else
+                    warnings.push_back("Línea " + numero + ": formato inválido \"" + w.text + "\". Se omite.");
+            }
+            primeraLinea += chunk.lines;
+        }
+    }
+
+    // Abre el archivo y lo decodifica como binario si tiene la firma del
+    // formato; si no, lo analiza como CSV.
+    template <typename T, typename Out, typename Decode, typename Fn>
+    bool LoadFile(const std::string &filename, SymbolTable &symbols, Out &out,
+                  std::vector<std::string> &warnings, unsigned threads, Decode decode, Fn parse)
+    {
+        ClearRows(out);
+        MappedFile file;
+        if (!file.Open(filename))
+            return false;
+
+        if (IsBinaryWorkload(file.Data(), file.Size()))
+        {
+            std::string error;
+            if (!decode(file.Data(), file.Size(), symbols, out, error, threads))
+                warnings.push_back("Archivo binario inválido (" + error + "). No se cargó ningún dato.");
+        }
+        else
+        {
+            ParseText<T>(file.Data(), file.Size(), symbols, out, warnings, threads, parse);
+        }
+        return true;
+    }
+
+    // Convierte varios campos enteros; devuelve el primer error encontrado
+    FieldError ParseInts(const std::string_view *fields, int *values, size_t count)
+    {
+        for (size_t k = 0; k < count; ++k)
+        {
+            FieldError error = ParseInt(fields[k], values[k]);
+            if (error != FieldError::None)
+                return error;
+        }
+        return FieldError::None;
+    }
+}
+
+bool LoadProcessFile(const std::string &filename, SymbolTable &symbols, Workload &out,
+                     std::vector<std::string> &warnings, unsigned threads)
+{
+    return LoadFile<SchedProcess>(filename, symbols, out, warnings, threads, DecodeBinaryProcesses,
+                    [](std::string_view line, SymbolTable &names, SchedProcess &p)
+                     {
+        std::string_view fields[5];
+        size_t count = SplitFields(line, fields, 5);
+        if (count < 4 || fields[0].empty())
+            return FieldError::Invalid;
+
+        // El periodo es opcional; un campo vacio equivale a no tenerlo
+        int valores[4] = {0, 0, 0, 0};
+        bool conPeriodo = count == 5 && !fields[4].empty();
+        FieldError error = ParseInts(fields + 1, valores, conPeriodo ? 4 : 3);
+        if (error != FieldError::None)
+            return error;
+
+        p.pid = names.Intern(fields[0]);
+        p.burstTime = valores[0];
+        p.arrivalTime = valores[1];
+        p.priority = valores[2];
+        p.period = valores[3];
+        return FieldError::None; });
+}
+
+bool LoadResourceFile(const std::string &filename, SymbolTable &symbols, std::vector<SyncResource> &out,
+                      std::vector<std::string> &warnings, unsigned threads)
+{
+    return LoadFile<SyncResource>(filename, symbols, out, warnings, threads, DecodeBinaryResources,
+                    [](std::string_view line, SymbolTable &names, SyncResource &r)
+                     {
+        std::string_view fields[2];
+        if (SplitFields(line, fields, 2) < 2 || fields[0].empty())
+            return FieldError::Invalid;
+
+        FieldError error = ParseInt(fields[1], r.counter);
+        if (error != FieldError::None)
+            return error;
+        r.name = names.Intern(fields[0]);
+        return FieldError::None; });
+}
+
+bool LoadActionFile(const std::string &filename, SymbolTable &symbols, std::vector<SyncAction> &out,
+                    std::vector<std::string> &warnings, unsigned threads)
+{
+    return LoadFile<SyncAction>(filename, symbols, out, warnings, threads, DecodeBinaryActions,
+                    [](std::string_view line, SymbolTable &names, SyncAction &a)
+                     {
+        std::string_view fields[4];
+        if (SplitFields(line, fields, 4) < 4 || fields[0].empty())
+            return FieldError::Invalid;
+
+        FieldError error = ParseInt(fields[3], a.cycle);
+        if (error != FieldError::None)
+            return error;
+        a.pid = names.Intern(fields[0]);
+        a.action = names.Intern(fields[1]);
+        a.resource = names.Intern(fields[2]);
+        return FieldError::None; });
+}
@@ -0,0 +1,53 @@
+#ifndef WORKLOAD_H
+#define WORKLOAD_H
+
+// Carga de archivos de carga de trabajo sin depender de wxWidgets.
+// Los archivos se proyectan en memoria y se recorren con un lector de CSV
+// propio, sin std::stringstream ni un string por campo. Los mismos cargadores
+// aceptan el formato binario de workload_binary.h, que se detecta por su firma.
+
+#include <string>
+#include <vector>
+
+#include "scheduler.h"
+
+// Los nombres (PID, recurso, accion) se guardan como IDs de una SymbolTable
+
+// Recurso: "NombreRecurso, ContadorInicial"
+struct SyncResource
+{
+    int name = 0;
+    int counter = 0;
+};
+
+// Accion: "PID, ACCION (READ/WRITE), Recurso, Ciclo"
+struct SyncAction
+{
+    int pid = 0;
+    int action = 0;
+    int resource = 0;
+    int cycle = 0;
+};
+
+// Cada cargador interna los nombres en 'symbols' (sin vaciarla, para que
+// varios archivos de la misma carga compartan los IDs) y devuelve false si
+// no se pudo abrir el archivo. Las lineas invalidas se omiten y se describen
+// en 'warnings' con su numero de linea. Los archivos grandes se dividen en
+// bloques que se analizan con 'threads' hilos (0 = todos los nucleos); el
+// resultado conserva el orden del archivo.
+
+// Procesos: "PID, Burst Time, Arrival Time, Prioridad[, Periodo]". El periodo
+// (EDF y RM) es opcional; sin el vale 0.
+bool LoadProcessFile(const std::string &filename, SymbolTable &symbols,
+                     Workload &out, std::vector<std::string> &warnings,
+                     unsigned threads = 0);
+
+bool LoadResourceFile(const std::string &filename, SymbolTable &symbols,
+                      std::vector<SyncResource> &out, std::vector<std::string> &warnings,
+                      unsigned threads = 0);
+
+bool LoadActionFile(const std::string &filename, SymbolTable &symbols,
+                    std::vector<SyncAction> &out, std::vector<std::string> &warnings,
+                    unsigned threads = 0);
+
+#endif // WORKLOAD_H
@@ -0,0 +1,356 @@
+#include "workload_binary.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <string_view>
+
+#include "parallel.h"
+
+static_assert(sizeof(BinaryHeader) == 48, "la cabecera binaria debe medir 48 bytes");
+static_assert(sizeof(int) == sizeof(int32_t), "las columnas se copian directo a vectores de int");
+
+namespace
+{
+    const char kMagic[8] = {'O', 'S', 'S', 'I', 'M', 'W', 'L', '\0'};
+
+    // Filas por trabajo al convertir columnas en paralelo
+    const size_t kRowsPerJob = size_t(1) << 16;
+
+    size_t Padded(size_t bytes)
+    {
+        return (bytes + 7) & ~size_t(7);
+    }
+
+    // Vista validada de un archivo binario proyectado en memoria
+    struct BinaryView
+    {
+        BinaryHeader header;
+        const char *offsets = nullptr; // uint64[strings + 1]
+        const char *text = nullptr;
+        const char *columns = nullptr; // int32[columns][rows]
+
+        uint64_t Offset(size_t i) const
+        {
+            uint64_t v;
+            std::memcpy(&v, offsets + i * sizeof(uint64_t), sizeof(v));
+            return v;
+        }
+
+        int32_t Value(size_t column, size_t row) const
+        {
+            int32_t v;
+            std::memcpy(&v, columns + (column * header.rows + row) * sizeof(int32_t), sizeof(v));
+            return v;
+        }
+
+        // Copia una columna completa de una sola vez
+        void CopyColumn(size_t column, int *dest) const
+        {
+            std::memcpy(dest, columns + column * header.rows * sizeof(int32_t),
+                        static_cast<size_t>(header.rows) * sizeof(int32_t));
+        }
+    };
+
+    // Acepta de 'columns' a 'columns + optionalColumns' columnas; las que
+    // faltan al final son columnas opcionales que el archivo no incluye
+    bool OpenView(const char *data, size_t size, BinaryKind kind, uint32_t columns,
+                  BinaryView &view, std::string &error, uint32_t optionalColumns = 0)
+    {
+        // 1. Cabecera
+        if (!IsBinaryWorkload(data, size) || size < sizeof(BinaryHeader))
+        {
+            error = "cabecera incompleta";
+            return false;
+        }
+        std::memcpy(&view.header, data, sizeof(BinaryHeader));
+        const BinaryHeader &h = view.header;
+        if (h.byteOrder != kBinaryByteOrder)
+        {
+            error = "orden de bytes distinto al de este equipo";
+            return false;
+        }
+        if (h.version != kBinaryVersion)
+        {
+            error = "version " + std::to_string(h.version) + " no soportada";
+            return false;
+        }
+        if (h.kind != static_cast<uint32_t>(kind) || h.columns < columns ||
+            h.columns > columns + optionalColumns)
+        {
+            error = "el archivo contiene otro tipo de datos";
+            return false;
+        }
+
+        // 2. Tamanos de cada seccion, sin desbordar
+        size_t resto = size - sizeof(BinaryHeader);
+        uint64_t bytesOffsets = (uint64_t(h.strings) + 1) * sizeof(uint64_t);
+        if (bytesOffsets > resto || h.stringBytes > resto - bytesOffsets)
+        {
+            error = "tabla de strings truncada";
+            return false;
+        }
+        size_t bytesTabla = Padded(static_cast<size_t>(bytesOffsets + h.stringBytes));
+        if (bytesTabla > resto ||
+            h.rows > (resto - bytesTabla) / (uint64_t(h.columns) * sizeof(int32_t)))
+        {
+            error = "columnas truncadas";
+            return false;
+        }
+
+        view.offsets = data + sizeof(BinaryHeader);
+        view.text = view.offsets + bytesOffsets;
+        view.columns = data + sizeof(BinaryHeader) + bytesTabla;
+
+        // 3. Desplazamientos crecientes dentro del texto
+        if (view.Offset(0) != 0 || view.Offset(h.strings) != h.stringBytes)
+        {
+            error = "tabla de strings inconsistente";
+            return false;
+        }
+        for (size_t i = 0; i < h.strings; ++i)
+        {
+            if (view.Offset(i) > view.Offset(i + 1))
+            {
+                error = "tabla de strings inconsistente";
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Interna la tabla de strings del archivo; devuelve el ID de cada entrada
+    std::vector<int> InternStrings(const BinaryView &view, SymbolTable &symbols)
+    {
+        std::vector<int> ids(view.header.strings);
+        for (size_t i = 0; i < ids.size(); ++i)
+        {
+            uint64_t inicio = view.Offset(i);
+            ids[i] = symbols.Intern(std::string_view(view.text + inicio,
+                                                     static_cast<size_t>(view.Offset(i + 1) - inicio)));
+        }
+        return ids;
+    }
+
+    // Traduce una columna de indices de la tabla del archivo a IDs de simbolo;
+    // devuelve false si algun indice esta fuera de la tabla
+    bool TranslateColumn(std::vector<int> &column, const std::vector<int> &names, unsigned threads)
+    {
+        std::atomic<bool> valido(true);
+        const size_t rows = column.size();
+        size_t trabajos = (rows + kRowsPerJob - 1) / kRowsPerJob;
+        ParallelFor(trabajos, [&](size_t k)
+                    {
+            size_t fin = std::min(rows, (k + 1) * kRowsPerJob);
+            for (size_t r = k * kRowsPerJob; r < fin; ++r)
+            {
+                int indice = column[r];
+                if (indice < 0 || static_cast<size_t>(indice) >= names.size())
+                {
+                    valido = false;
+                    return;
+                }
+                column[r] = names[indice];
+            } },
+                    threads);
+        return valido;
+    }
+
+    // Convierte las filas en paralelo; fill(vista, ids, fila, destino) devuelve
+    // false si la fila referencia un string inexistente.
+    template <typename T, typename Fn>
+    bool Decode(const char *data, size_t size, BinaryKind kind, uint32_t columns, SymbolTable &symbols,
+                std::vector<T> &out, std::string &error, unsigned threads, Fn fill)
+    {
+        out.clear();
+        BinaryView view;
+        if (!OpenView(data, size, kind, columns, view, error))
+            return false;
+
+        const std::vector<int> names = InternStrings(view, symbols);
+        const size_t rows = static_cast<size_t>(view.header.rows);
+        out.resize(rows);
+
+        std::atomic<bool> valido(true);
+        size_t trabajos = (rows + kRowsPerJob - 1) / kRowsPerJob;
+        ParallelFor(trabajos, [&](size_t k)
+                    {
+            size_t fin = std::min(rows, (k + 1) * kRowsPerJob);
+            for (size_t r = k * kRowsPerJob; r < fin; ++r)
+            {
+                if (!fill(view, names, r, out[r]))
+                    valido = false;
+            } },
+                    threads);
+
+        if (!valido)
+        {
+            out.clear();
+            error = "indice de string fuera de rango";
+            return false;
+        }
+        return true;
+    }
+
+    // Traduce el indice de la tabla del archivo al ID de la tabla de simbolos
+    bool Name(const std::vector<int> &names, int32_t index, int &dest)
+    {
+        if (index < 0 || static_cast<size_t>(index) >= names.size())
+            return false;
+        dest = names[index];
+        return true;
+    }
+
+    template <typename T>
+    void WriteRaw(std::ofstream &file, const T *values, size_t count)
+    {
+        file.write(reinterpret_cast<const char *>(values), static_cast<std::streamsize>(count * sizeof(T)));
+    }
+
+    bool Write(const std::string &filename, BinaryKind kind, const SymbolTable &table,
+               const std::vector<const std::vector<int> *> &columns, size_t rows)
+    {
+        std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+        if (!file.is_open())
+            return false;
+
+        std::vector<uint64_t> offsets{0};
+        offsets.reserve(table.Size() + 1);
+        for (size_t i = 0; i < table.Size(); ++i)
+            offsets.push_back(offsets.back() + table.Name(static_cast<int>(i)).size());
+
+        BinaryHeader h = {};
+        std::memcpy(h.magic, kMagic, sizeof(kMagic));
+        h.version = kBinaryVersion;
+        h.kind = static_cast<uint32_t>(kind);
+        h.byteOrder = kBinaryByteOrder;
+        h.columns = static_cast<uint32_t>(columns.size());
+        h.strings = static_cast<uint32_t>(table.Size());
+        h.rows = rows;
+        h.stringBytes = offsets.back();
+
+        WriteRaw(file, &h, 1);
+        WriteRaw(file, offsets.data(), offsets.size());
+        for (size_t i = 0; i < table.Size(); ++i)
+        {
+            const std::string &n = table.Name(static_cast<int>(i));
+            file.write(n.data(), static_cast<std::streamsize>(n.size()));
+        }
+        size_t tabla = offsets.size() * sizeof(uint64_t) + static_cast<size_t>(h.stringBytes);
+        const char relleno[8] = {};
+        file.write(relleno, static_cast<std::streamsize>(Padded(tabla) - tabla));
+        for (const auto *col : columns)
+            WriteRaw(file, col->data(), col->size());
+
+        return static_cast<bool>(file);
+    }
+}
+
+bool IsBinaryWorkload(const char *data, size_t size)
+{
+    return size >= sizeof(kMagic) && std::memcmp(data, kMagic, sizeof(kMagic)) == 0;
+}
+
+bool DecodeBinaryProcesses(const char *data, size_t size, SymbolTable &symbols,
+                           Workload &out, std::string &error, unsigned threads)
+{
+    // Las columnas del archivo y las de Workload tienen el mismo formato: se
+    // copian enteras y solo la de PID se traduce. Sin la columna opcional de
+    // periodo, todos los procesos quedan con periodo 0.
+    out.Clear();
+    BinaryView view;
+    if (!OpenView(data, size, BinaryKind::Processes, 4, view, error, 1))
+        return false;
+
+    const std::vector<int> names = InternStrings(view, symbols);
+    const size_t rows = static_cast<size_t>(view.header.rows);
+    std::vector<int> *columnas[5] = {&out.pid, &out.burstTime, &out.arrivalTime, &out.priority,
+                                     &out.period};
+    for (size_t c = 0; c < 5; ++c)
+    {
+        columnas[c]->assign(rows, 0);
+        if (c < view.header.columns)
+            view.CopyColumn(c, columnas[c]->data());
+    }
+
+    if (!TranslateColumn(out.pid, names, threads))
+    {
+        out.Clear();
+        error = "indice de string fuera de rango";
+        return false;
+    }
+    return true;
+}
+
+bool DecodeBinaryResources(const char *data, size_t size, SymbolTable &symbols,
+                           std::vector<SyncResource> &out, std::string &error, unsigned threads)
+{
+    return Decode(data, size, BinaryKind::Resources, 2, symbols, out, error, threads,
+                  [](const BinaryView &v, const std::vector<int> &names, size_t r, SyncResource &res)
+                  {
+                      res.counter = v.Value(1, r);
+                      return Name(names, v.Value(0, r), res.name);
+                  });
+}
+
+bool DecodeBinaryActions(const char *data, size_t size, SymbolTable &symbols,
+                         std::vector<SyncAction> &out, std::string &error, unsigned threads)
+{
+    return Decode(data, size, BinaryKind::Actions, 4, symbols, out, error, threads,
+                  [](const BinaryView &v, const std::vector<int> &names, size_t r, SyncAction &a)
+                  {
+                      a.cycle = v.Value(3, r);
+                      return Name(names, v.Value(0, r), a.pid) &&
+                             Name(names, v.Value(1, r), a.action) &&
+                             Name(names, v.Value(2, r), a.resource);
+                  });
+}
+
+bool SaveProcessFileBinary(const std::string &filename, const SymbolTable &symbols,
+                           const Workload &procs)
+{
+    // Solo la columna de PID se reescribe; las demas se escriben tal cual
+    SymbolTable table;
+    std::vector<int> pids(procs.Size());
+    for (size_t i = 0; i < procs.Size(); ++i)
+        pids[i] = table.Intern(symbols.Name(procs.pid[i]));
+    std::vector<const std::vector<int> *> columnas = {&pids, &procs.burstTime, &procs.arrivalTime,
+                                                      &procs.priority};
+
+    // El periodo solo se escribe si algun proceso lo usa, de modo que los
+    // archivos sin tiempo real siguen teniendo cuatro columnas
+    if (std::any_of(procs.period.begin(), procs.period.end(), [](int p)
+                    { return p != 0; }))
+        columnas.push_back(&procs.period);
+    return Write(filename, BinaryKind::Processes, table, columnas, procs.Size());
+}
+
+bool SaveResourceFileBinary(const std::string &filename, const SymbolTable &symbols,
+                            const std::vector<SyncResource> &resources)
+{
+    SymbolTable table;
+    std::vector<std::vector<int>> columns(2, std::vector<int>(resources.size()));
+    for (size_t i = 0; i < resources.size(); ++i)
+    {
+        columns[0][i] = table.Intern(symbols.Name(resources[i].name));
+        columns[1][i] = resources[i].counter;
+    }
+    return Write(filename, BinaryKind::Resources, table, {&columns[0], &columns[1]}, resources.size());
+}
+
+bool SaveActionFileBinary(const std::string &filename, const SymbolTable &symbols,
+                          const std::vector<SyncAction> &actions)
+{
+    SymbolTable table;
+    std::vector<std::vector<int>> columns(4, std::vector<int>(actions.size()));
+    for (size_t i = 0; i < actions.size(); ++i)
+    {
+        columns[0][i] = table.Intern(symbols.Name(actions[i].pid));
+        columns[1][i] = table.Intern(symbols.Name(actions[i].action));
+        columns[2][i] = table.Intern(symbols.Name(actions[i].resource));
+        columns[3][i] = actions[i].cycle;
+    }
+    return Write(filename, BinaryKind::Actions, table,
+                 {&columns[0], &columns[1], &columns[2], &columns[3]}, actions.size());
+}
@@ -0,0 +1,70 @@
+#ifndef WORKLOAD_BINARY_H
+#define WORKLOAD_BINARY_H
+
+// Formato binario de carga de trabajo. Evita volver a analizar el CSV en
+// cada arranque: el archivo se proyecta en memoria y se lee por columnas.
+//
+// Estructura (enteros en el orden de bytes del equipo que lo escribio):
+//   1. Cabecera fija (BinaryHeader, 48 bytes)
+//   2. Tabla de strings: 'strings + 1' desplazamientos uint64 seguidos de
+//      'stringBytes' bytes de texto, rellenados hasta multiplo de 8
+//   3. 'columns' columnas de 'rows' enteros int32 cada una
+//
+// Columnas por tipo (los nombres son indices en la tabla de strings):
+//   procesos: pid, burst, llegada, prioridad[, periodo]
+//   recursos: nombre, contador
+//   acciones: pid, accion, recurso, ciclo
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "workload.h"
+
+enum class BinaryKind : uint32_t
+{
+    Processes = 1,
+    Resources = 2,
+    Actions = 3
+};
+
+struct BinaryHeader
+{
+    char magic[8];        // "OSSIMWL" + '\0'
+    uint32_t version;     // kBinaryVersion
+    uint32_t kind;        // BinaryKind
+    uint32_t byteOrder;   // kBinaryByteOrder escrito en el orden del equipo
+    uint32_t columns;
+    uint32_t strings;     // entradas de la tabla de strings
+    uint32_t reserved;
+    uint64_t rows;
+    uint64_t stringBytes;
+};
+
+const uint32_t kBinaryVersion = 1;
+const uint32_t kBinaryByteOrder = 0x01020304;
+
+// true si el contenido empieza con la firma del formato binario
+bool IsBinaryWorkload(const char *data, size_t size);
+
+// Decodifican un archivo binario ya proyectado en memoria e internan su tabla
+// de strings en 'symbols'. Devuelven false (con el motivo en 'error') si la
+// cabecera o los tamanos no son validos.
+bool DecodeBinaryProcesses(const char *data, size_t size, SymbolTable &symbols,
+                           Workload &out, std::string &error, unsigned threads = 0);
+bool DecodeBinaryResources(const char *data, size_t size, SymbolTable &symbols,
+                           std::vector<SyncResource> &out, std::string &error, unsigned threads = 0);
+bool DecodeBinaryActions(const char *data, size_t size, SymbolTable &symbols,
+                         std::vector<SyncAction> &out, std::string &error, unsigned threads = 0);
+
+// Escriben el formato binario; la tabla del archivo solo incluye los nombres
+// usados. Devuelven false si no se pudo escribir.
+bool SaveProcessFileBinary(const std::string &filename, const SymbolTable &symbols,
+                           const Workload &procs);
+bool SaveResourceFileBinary(const std::string &filename, const SymbolTable &symbols,
+                            const std::vector<SyncResource> &resources);
+bool SaveActionFileBinary(const std::string &filename, const SymbolTable &symbols,
+                          const std::vector<SyncAction> &actions);
+
+#endif // WORKLOAD_BINARY_H